@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+// File: Bench.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+// SDL 없이 shmup_core 만으로 돌리는 마이크로 벤치마크.
+// 사용법: shmup_bench [--filter 이름앞부분] [--out 결과.json]
+// --out 이 없으면 JSON 을 표준 출력으로 쓰고, 있으면 파일에 쓰고 표를 출력한다.
+// 커밋마다 같은 머신에서 돌려서 값을 비교하면 성능 저하를 잡을 수 있다.
+
+#include "Bench.hpp"
+
+#include <cstring>
+#include <iostream>
+
+#include "Simd.hpp"
+
+namespace shmup {
+namespace bench {
+
+namespace {
+volatile float s_floatSink = 0.0f;
+volatile unsigned s_unsignedSink = 0;
+
+const char* simdName() {
+#if SHMUP_SIMD_SSE
+  return "sse";
+#elif SHMUP_SIMD_NEON
+  return "neon";
+#else
+  return "scalar";
+#endif
+}
+}  // namespace
+
+void sink(float value) { s_floatSink = s_floatSink + value; }
+
+void sink(unsigned value) { s_unsignedSink = s_unsignedSink + value; }
+
+Report::Report(const char* filter) : m_filter(filter) {}
+
+bool Report::matches(const char* name) const {
+  return m_filter == nullptr ||
+         std::strncmp(name, m_filter, std::strlen(m_filter)) == 0;
+}
+
+void Report::add(const char* name, const char* unit, double value,
+                 double nsPerOp) {
+  if (m_count == s_maxResults) {
+    std::cout << "Bench too many results, dropped " << name << "\n";
+    return;
+  }
+  m_results[m_count++] = {name, unit, value, nsPerOp};
+}
+
+void Report::writeJson(FILE* out) const {
+  std::fprintf(out, "{\n  \"simd\": \"%s\",\n  \"benchmarks\": [", simdName());
+  for (unsigned i = 0; i < m_count; ++i) {
+    const Result& r = m_results[i];
+    std::fprintf(out,
+                 "%s\n    {\"name\": \"%s\", \"unit\": \"%s\", \"value\": %.6g, "
+                 "\"ns_per_op\": %.6g}",
+                 i == 0 ? "" : ",", r.name, r.unit, r.value, r.nsPerOp);
+  }
+  std::fprintf(out, "\n  ]\n}\n");
+}
+
+void Report::print() const {
+  for (unsigned i = 0; i < m_count; ++i) {
+    const Result& r = m_results[i];
+    std::printf("%-32s %14.3f %-12s %12.1f ns/op\n", r.name, r.value, r.unit,
+                r.nsPerOp);
+  }
+}
+
+}  // namespace bench
+}  // namespace shmup
+
+int main(int argc, char* argv[]) {
+  const char* filter = nullptr;
+  const char* outPath = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+      filter = argv[++i];
+    } else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      outPath = argv[++i];
+    } else {
+      std::cout << "usage: shmup_bench [--filter prefix] [--out result.json]\n";
+      return 1;
+    }
+  }
+
+  shmup::bench::Report report(filter);
+  shmup::bench::runMathBench(report);
+  shmup::bench::runBlendBench(report);
+  shmup::bench::runCollisionBench(report);
+  shmup::bench::runEcsBench(report);
+  shmup::bench::runPatternBench(report);
+  shmup::bench::runPoolBench(report);
+  shmup::bench::runRandomBench(report);
+  shmup::bench::runTGABench(report);
+
+  if (outPath == nullptr) {
+    report.writeJson(stdout);
+    return 0;
+  }
+
+  FILE* out = std::fopen(outPath, "w");
+  if (out == nullptr) {
+    std::cout << "Bench open " << outPath << " failed \n";
+    return 1;
+  }
+  report.writeJson(out);
+  std::fclose(out);
+  report.print();
+  return 0;
+}
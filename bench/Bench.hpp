@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------
+// File: Bench.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+namespace shmup {
+namespace bench {
+
+// 한번에 실행할 수 있는 최대 측정 항목 수
+constexpr unsigned s_maxResults = 64;
+
+// 한 묶음(batch)이 최소한 이 시간 이상 걸리도록 반복 횟수를 늘림
+constexpr double s_minBatchSeconds = 0.05;
+
+// 묶음을 이만큼 재서 가장 빠른 값을 사용 (다른 프로세스의 방해를 줄임)
+constexpr unsigned s_batchCount = 5;
+
+/// @brief 측정 항목 하나의 결과
+struct Result {
+  const char* name;
+  const char* unit;   // value 의 단위. 예: "Mpixels/s"
+  double value;       // 초당 처리량
+  double nsPerOp;     // body 한번에 걸린 시간
+};
+
+/// @brief 측정 항목을 실행하고 결과를 모으는 곳.
+/// 항목 이름은 "영역.항목" 형태이며 --filter 로 앞부분이 같은 항목만 실행할 수 있다
+class Report {
+ public:
+  explicit Report(const char* filter);
+
+  /// @brief 이름이 필터와 맞으면 body 를 반복 실행해서 처리량을 기록.
+  /// unitsPerOp 는 body 한번이 처리하는 양 (unit 기준)
+  template <typename Body>
+  void run(const char* name, const char* unit, double unitsPerOp, Body body) {
+    if (matches(name) == false) {
+      return;
+    }
+    body();  // 캐시와 분기 예측을 데움
+
+    unsigned iterations = 1;
+    double batchNs = measure(iterations, body);
+    while (batchNs < s_minBatchSeconds * 1e9) {
+      iterations *= 2;
+      batchNs = measure(iterations, body);
+    }
+
+    double bestNs = batchNs / iterations;
+    for (unsigned i = 1; i < s_batchCount; ++i) {
+      const double ns = measure(iterations, body) / iterations;
+      if (ns < bestNs) {
+        bestNs = ns;
+      }
+    }
+    add(name, unit, unitsPerOp / (bestNs * 1e-9), bestNs);
+  }
+
+  /// @brief 결과를 JSON 으로 출력
+  void writeJson(FILE* out) const;
+
+  /// @brief 결과를 사람이 읽기 쉬운 표로 출력
+  void print() const;
+
+ private:
+  template <typename Body>
+  static double measure(unsigned iterations, Body& body) {
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+      body();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+  }
+
+  bool matches(const char* name) const;
+
+  void add(const char* name, const char* unit, double value, double nsPerOp);
+
+ private:
+  const char* m_filter = nullptr;
+
+  Result m_results[s_maxResults];
+
+  unsigned m_count = 0;
+};
+
+/// @brief 계산 결과를 버리지 않도록 전역 volatile 에 씀
+void sink(float value);
+void sink(unsigned value);
+
+void runMathBench(Report& report);
+void runBlendBench(Report& report);
+void runCollisionBench(Report& report);
+void runEcsBench(Report& report);
+void runPatternBench(Report& report);
+void runPoolBench(Report& report);
+void runRandomBench(Report& report);
+void runTGABench(Report& report);
+
+}  // namespace bench
+}  // namespace shmup
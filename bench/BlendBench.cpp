@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// File: BlendBench.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "Bench.hpp"
+#include "Blend.hpp"
+#include "Random.hpp"
+
+namespace shmup {
+namespace bench {
+
+namespace {
+// 화면 한 줄 너비의 span 을 이만큼 블렌딩하는 것이 한번의 측정 단위
+constexpr unsigned s_spanWidth = 480;
+constexpr unsigned s_spanCount = 64;
+constexpr unsigned s_pixelCount = s_spanWidth * s_spanCount;
+}  // namespace
+
+void runBlendBench(Report& report) {
+  RGBA* src = new RGBA[s_pixelCount];
+  RGBA* dst = new RGBA[s_pixelCount];
+
+  // 스프라이트처럼 투명, 반투명, 불투명 픽셀이 섞인 입력
+  Random random(2);
+  for (unsigned i = 0; i < s_pixelCount; ++i) {
+    const uint32_t bits = random.next();
+    const uint8_t alphas[4] = {0, 96, 192, 255};
+    src[i] = {(uint8_t)bits, (uint8_t)(bits >> 8), (uint8_t)(bits >> 16),
+              alphas[bits >> 30]};
+    dst[i] = {(uint8_t)(bits >> 4), (uint8_t)(bits >> 12), 32, 255};
+  }
+
+  report.run("blend.alpha_span", "Mpixels/s", s_pixelCount / 1e6, [&] {
+    for (unsigned i = 0; i < s_spanCount; ++i) {
+      Blend::alphaSpan(src + i * s_spanWidth, dst + i * s_spanWidth,
+                       s_spanWidth);
+    }
+    sink((unsigned)dst[s_pixelCount - 1].r);
+  });
+
+  delete[] dst;
+  delete[] src;
+}
+
+}  // namespace bench
+}  // namespace shmup
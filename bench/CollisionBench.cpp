@@ -0,0 +1,74 @@
+//------------------------------------------------------------------------------
+// File: CollisionBench.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "Bench.hpp"
+#include "BulletPattern.hpp"
+#include "CircleCollider.hpp"
+#include "Random.hpp"
+
+namespace shmup {
+namespace bench {
+
+namespace {
+constexpr unsigned s_enemyCount = 256;
+constexpr unsigned s_bulletCount = 256;
+constexpr unsigned s_patternBulletCount = 8192;
+}  // namespace
+
+void runCollisionBench(Report& report) {
+  CircleCollider* enemies = new CircleCollider[s_enemyCount];
+  CircleCollider* bullets = new CircleCollider[s_bulletCount];
+
+  Random random(3);
+  for (unsigned i = 0; i < s_enemyCount; ++i) {
+    enemies[i] = {{random.range(0.0f, 480.0f), random.range(0.0f, 640.0f)},
+                  32.0f};
+  }
+  for (unsigned i = 0; i < s_bulletCount; ++i) {
+    bullets[i] = {{random.range(0.0f, 480.0f), random.range(0.0f, 640.0f)},
+                  4.0f};
+  }
+
+  // 적 x 플레이어 총알 전체 쌍 (World 충돌 검사의 안쪽 루프)
+  const double pairs = (double)s_enemyCount * s_bulletCount;
+  report.run("collision.circle_pairs", "Mpairs/s", pairs / 1e6, [&] {
+    unsigned hits = 0;
+    for (unsigned i = 0; i < s_enemyCount; ++i) {
+      for (unsigned j = 0; j < s_bulletCount; ++j) {
+        hits += circlesOverlap(enemies[i].position, enemies[i].radius,
+                               bullets[j].position, bullets[j].radius);
+      }
+    }
+    sink(hits);
+  });
+
+  // 적 탄막 <-> 플레이어. 대부분의 틱처럼 맞는 탄이 없는 경우를 잼
+  PatternEngine patterns;
+  if (patterns.init(s_patternBulletCount, 1000.0f / 60, 480.0f, 640.0f,
+                    16.0f)) {
+    const PatternDesc radial = {PatternRadial, 256, 0.1f, 0.0f, 0.0f, 0.0f,
+                                0.0f};
+    while (patterns.count() + radial.count <= patterns.capacity()) {
+      const Vector2 origin(random.range(0.0f, 480.0f),
+                           random.range(0.0f, 320.0f));
+      patterns.emit(radial, origin, origin);
+    }
+    for (unsigned i = 0; i < 30; ++i) {
+      patterns.update();
+    }
+    const Vector2 player(240.0f, 10000.0f);
+    report.run("collision.pattern_scan", "Mbullets/s",
+               patterns.count() / 1e6,
+               [&] { sink(patterns.collide(player, 16.0f)); });
+  }
+
+  delete[] bullets;
+  delete[] enemies;
+}
+
+}  // namespace bench
+}  // namespace shmup
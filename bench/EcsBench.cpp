@@ -0,0 +1,83 @@
+//------------------------------------------------------------------------------
+// File: EcsBench.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "Bench.hpp"
+#include "ECS.hpp"
+#include "Random.hpp"
+
+namespace shmup {
+namespace bench {
+
+namespace {
+// 적 아키타입과 같은 컬럼 구성 (swap-remove 비용이 같도록)
+constexpr ComponentMask s_entityComponents = ComponentPosition |
+                                             ComponentVelocity | ComponentSize |
+                                             ComponentCollider | ComponentSprite;
+
+constexpr float s_tick = 1000.0f / 60;
+
+// 화면 높이 + 적 높이 (EnemyManager 의 제거 위치)
+constexpr float s_maxY = 704.0f;
+
+/// 엔티티 수별 항목. 이름은 Report 에 그대로 저장되므로 문자열 상수를 씀
+struct MotionCase {
+  const char* name;
+  unsigned count;
+};
+
+const MotionCase s_motionCases[] = {
+    {"ecs.motion_despawn.1k", 1000},
+    {"ecs.motion_despawn.10k", 10000},
+    {"ecs.motion_despawn.100k", 100000},
+};
+
+void spawn(Registry& registry, Archetype* archetype, Random& random, float y) {
+  unsigned row = 0;
+  if (registry.create(archetype, &row).index == InvalidEntity.index) {
+    return;
+  }
+  archetype->positions[row] = {random.range(0.0f, 416.0f), y};
+  archetype->previousPositions[row] = archetype->positions[row];
+  archetype->velocities[row] = {0.0f, random.range(0.05f, 0.15f)};
+  archetype->sizes[row] = {64.0f, 64.0f};
+  archetype->colliders[row] = {{32.0f, 32.0f}, 32.0f};
+  archetype->sprites[row] = 0;
+}
+}  // namespace
+
+void runEcsBench(Report& report) {
+  // 적이 내려오는 한 틱: 이동 시스템, 화면 아래로 나간 엔티티 제거, 제거된 만큼 다시 스폰.
+  // 시작 y 를 화면 전체에 흩어 두어서 틱마다 일부만 제거되는 상태를 유지
+  for (const MotionCase& motionCase : s_motionCases) {
+    Registry registry;
+    if (registry.init(motionCase.count) == false) {
+      continue;
+    }
+    Archetype* archetype =
+        registry.createArchetype(s_entityComponents, motionCase.count);
+    if (archetype == nullptr) {
+      continue;
+    }
+
+    Random random(5);
+    for (unsigned i = 0; i < motionCase.count; ++i) {
+      spawn(registry, archetype, random, random.range(0.0f, s_maxY));
+    }
+
+    report.run(motionCase.name, "Mentities/s", motionCase.count / 1e6, [&] {
+      integrateMotion(registry, s_tick);
+      const unsigned destroyed = destroyBeyondY(registry, archetype, s_maxY);
+      for (unsigned i = 0; i < destroyed; ++i) {
+        spawn(registry, archetype, random, 0.0f);
+      }
+      sink(destroyed);
+    });
+  }
+}
+
+}  // namespace bench
+}  // namespace shmup
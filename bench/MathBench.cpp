@@ -0,0 +1,174 @@
+//------------------------------------------------------------------------------
+// File: MathBench.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+// 예전 구현(연산자와 distance 가 Math.cpp 에 따로 정의되어 매번 함수 호출)을
+// 그대로 옮긴 legacy 항목과 인라인/배열 버전을 같은 입력으로 비교한다.
+
+#include <cmath>
+
+#include "Bench.hpp"
+#include "Math.hpp"
+#include "Random.hpp"
+
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+namespace shmup {
+namespace bench {
+
+namespace {
+
+constexpr unsigned s_pointCount = 4096;
+constexpr unsigned s_circleSegments = 64;
+constexpr unsigned s_circleCount = s_pointCount / s_circleSegments;
+
+// 처리량 단위: 초당 백만 좌표
+constexpr double s_mpointsPerOp = s_pointCount / 1e6;
+
+// LTO 없이 다른 번역 단위에 있던 예전 구현을 흉내내기 위해 인라인을 막음
+struct LegacyVector2 {
+  float x;
+  float y;
+
+  BENCH_NOINLINE LegacyVector2 operator+(const LegacyVector2& other) const {
+    return {x + other.x, y + other.y};
+  }
+  BENCH_NOINLINE LegacyVector2 operator-(const LegacyVector2& other) const {
+    return {x - other.x, y - other.y};
+  }
+};
+
+BENCH_NOINLINE float legacyDistance(const LegacyVector2& a,
+                                    const LegacyVector2& b) {
+  return std::sqrt(std::fabs(a.x - b.x) * std::fabs(a.x - b.x) +
+                   std::fabs(a.y - b.y) * std::fabs(a.y - b.y));
+}
+
+BENCH_NOINLINE LegacyVector2 legacyLerp(const LegacyVector2& a,
+                                        const LegacyVector2& b, float t) {
+  return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t};
+}
+
+// 예전 createCirclePoints 처럼 점마다 cos/sin 을 호출
+BENCH_NOINLINE void legacyCirclePoints(LegacyVector2* points, unsigned segments,
+                                       float x, float y, float radius) {
+  const float step = 6.28318531f / segments;
+  for (unsigned i = 0; i < segments; ++i) {
+    points[i] = {x + std::cos(step * i) * radius,
+                 y + std::sin(step * i) * radius};
+  }
+}
+
+}  // namespace
+
+void runMathBench(Report& report) {
+  Vector2* points = new Vector2[s_pointCount];
+  Vector2* targets = new Vector2[s_pointCount];
+  Vector2* results = new Vector2[s_pointCount];
+  float* radii = new float[s_circleCount];
+  LegacyVector2* legacyPoints = new LegacyVector2[s_pointCount];
+  LegacyVector2* legacyTargets = new LegacyVector2[s_pointCount];
+  LegacyVector2* legacyResults = new LegacyVector2[s_pointCount];
+
+  Random random(1);
+  for (unsigned i = 0; i < s_pointCount; ++i) {
+    points[i] = {random.range(0.0f, 480.0f), random.range(0.0f, 640.0f)};
+    targets[i] = {random.range(0.0f, 480.0f), random.range(0.0f, 640.0f)};
+    legacyPoints[i] = {points[i].x, points[i].y};
+    legacyTargets[i] = {targets[i].x, targets[i].y};
+  }
+  for (unsigned i = 0; i < s_circleCount; ++i) {
+    radii[i] = 4.0f + (float)(i % 16);
+  }
+  const Vector2 center(240.0f, 320.0f);
+  const LegacyVector2 legacyCenter = {center.x, center.y};
+  const float radius = 32.0f;
+
+  // 원 충돌 검사: sqrt 거리 vs 제곱 거리 vs 배열 제곱 거리
+  report.run("math.overlap.legacy", "Mpoints/s", s_mpointsPerOp, [&] {
+    unsigned hits = 0;
+    for (unsigned i = 0; i < s_pointCount; ++i) {
+      hits += legacyDistance(legacyPoints[i], legacyCenter) <= radius;
+    }
+    sink(hits);
+  });
+  report.run("math.overlap", "Mpoints/s", s_mpointsPerOp, [&] {
+    unsigned hits = 0;
+    for (unsigned i = 0; i < s_pointCount; ++i) {
+      hits += Math::distanceSq(points[i], center) <= radius * radius;
+    }
+    sink(hits);
+  });
+
+  // 보간
+  report.run("math.lerp.legacy", "Mpoints/s", s_mpointsPerOp, [&] {
+    for (unsigned i = 0; i < s_pointCount; ++i) {
+      legacyResults[i] = legacyLerp(legacyPoints[i], legacyTargets[i], 0.5f);
+    }
+    sink(legacyResults[s_pointCount - 1].x);
+  });
+  report.run("math.lerp", "Mpoints/s", s_mpointsPerOp, [&] {
+    for (unsigned i = 0; i < s_pointCount; ++i) {
+      results[i] = Math::lerp(points[i], targets[i], 0.5f);
+    }
+    sink(results[s_pointCount - 1].x);
+  });
+  report.run("math.lerp.batch", "Mpoints/s", s_mpointsPerOp, [&] {
+    Math::lerp(points, targets, s_pointCount, 0.5f, results);
+    sink(results[s_pointCount - 1].x);
+  });
+
+  // 제자리 이동. 반복 횟수가 달라도 값이 작아서 처리 시간에는 영향이 없음
+  const Vector2 offset(0.5f, -0.25f);
+  const LegacyVector2 legacyOffset = {offset.x, offset.y};
+  report.run("math.translate.legacy", "Mpoints/s", s_mpointsPerOp, [&] {
+    for (unsigned i = 0; i < s_pointCount; ++i) {
+      legacyPoints[i] = legacyPoints[i] + legacyOffset;
+    }
+    sink(legacyPoints[s_pointCount - 1].x);
+  });
+  report.run("math.translate", "Mpoints/s", s_mpointsPerOp, [&] {
+    for (unsigned i = 0; i < s_pointCount; ++i) {
+      points[i] = points[i] + offset;
+    }
+    sink(points[s_pointCount - 1].x);
+  });
+  report.run("math.translate.batch", "Mpoints/s", s_mpointsPerOp, [&] {
+    Math::translate(points, s_pointCount, offset);
+    sink(points[s_pointCount - 1].x);
+  });
+
+  // 원 외곽선: 점마다 삼각함수 vs 단위 원 테이블
+  CircleTable circleTable;
+  circleTable.init(s_circleSegments);
+  report.run("math.circle.legacy", "Mpoints/s", s_mpointsPerOp, [&] {
+    for (unsigned i = 0; i < s_circleCount; ++i) {
+      legacyCirclePoints(legacyResults + i * s_circleSegments,
+                         s_circleSegments, legacyTargets[i].x,
+                         legacyTargets[i].y, radii[i]);
+    }
+    sink(legacyResults[s_pointCount - 1].x);
+  });
+  report.run("math.circle.table", "Mpoints/s", s_mpointsPerOp, [&] {
+    circleTable.outline(targets, radii, s_circleCount, results);
+    sink(results[s_pointCount - 1].x);
+  });
+
+  delete[] legacyResults;
+  delete[] legacyTargets;
+  delete[] legacyPoints;
+  delete[] radii;
+  delete[] results;
+  delete[] targets;
+  delete[] points;
+}
+
+}  // namespace bench
+}  // namespace shmup
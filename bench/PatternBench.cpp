@@ -0,0 +1,57 @@
+//------------------------------------------------------------------------------
+// File: PatternBench.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "Bench.hpp"
+#include "BulletPattern.hpp"
+#include "Random.hpp"
+
+namespace shmup {
+namespace bench {
+
+namespace {
+// 한 코어에서 60 Hz 로 돌려야 하는 목표 탄 수
+constexpr unsigned s_bulletCount = 50000;
+
+constexpr unsigned s_volleyBulletCount = 250;
+
+// 측정하는 동안 탄이 화면 밖으로 나가 제거되지 않도록 아주 넓은 영역을 씀.
+// 개수가 고정되므로 갱신(궤적 계산과 화면 밖 검사)만 잼
+constexpr float s_fieldSize = 1.0e7f;
+}  // namespace
+
+void runPatternBench(Report& report) {
+  PatternEngine patterns;
+  if (patterns.init(s_bulletCount, 1000.0f / 60, s_fieldSize, s_fieldSize,
+                    0.0f) == false) {
+    return;
+  }
+
+  // 방사, 스파이럴, 가속하는 조준탄을 섞어서 채움
+  Random random(7);
+  const PatternDesc descs[] = {
+      {PatternRadial, s_volleyBulletCount, 0.15f, 0.0f, 0.0f, 0.0f, 0.0f},
+      {PatternSpiral, s_volleyBulletCount, 0.15f, 0.0f, 0.0015f, 0.0f, 0.0f},
+      {PatternAimed, s_volleyBulletCount, 0.15f, 0.00015f, 0.0f, 0.0f, 0.5f},
+  };
+  const Vector2 target(s_fieldSize * 0.5f, s_fieldSize);
+  for (unsigned i = 0; patterns.count() + s_volleyBulletCount <= s_bulletCount;
+       ++i) {
+    PatternDesc desc = descs[i % 3];
+    desc.startAngle = random.range(0.0f, 6.28318531f);
+    const Vector2 origin(s_fieldSize * 0.5f + random.range(-240.0f, 240.0f),
+                         s_fieldSize * 0.5f + random.range(-320.0f, 320.0f));
+    patterns.emit(desc, origin, target);
+  }
+
+  report.run("pattern.update", "Mbullets/s", patterns.count() / 1e6, [&] {
+    patterns.update();
+    sink(patterns.count());
+  });
+}
+
+}  // namespace bench
+}  // namespace shmup
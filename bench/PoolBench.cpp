@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// File: PoolBench.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "Bench.hpp"
+#include "Bullet.hpp"
+#include "ObjectPool.hpp"
+
+namespace shmup {
+namespace bench {
+
+namespace {
+constexpr unsigned s_poolCapacity = 1024;
+
+// 해제 순서를 섞는 데 쓰는 홀수 간격 (용량과 서로소)
+constexpr unsigned s_releaseStride = 7;
+}  // namespace
+
+void runPoolBench(Report& report) {
+  ObjectPool<Bullet> pool;
+  if (pool.init(s_poolCapacity) == false) {
+    return;
+  }
+  PoolHandle* handles = new PoolHandle[s_poolCapacity];
+
+  // 가득 채운 뒤 섞인 순서로 전부 해제. 스폰과 디스폰 한 쌍이 처리 단위
+  report.run("pool.spawn_despawn", "Mpairs/s", s_poolCapacity / 1e6, [&] {
+    for (unsigned i = 0; i < s_poolCapacity; ++i) {
+      Bullet* bullet = pool.acquire(&handles[i]);
+      bullet->speed((float)i);
+    }
+    for (unsigned i = 0; i < s_poolCapacity; ++i) {
+      pool.release(handles[(i * s_releaseStride) % s_poolCapacity]);
+    }
+    sink(pool.liveCount());
+  });
+
+  delete[] handles;
+}
+
+}  // namespace bench
+}  // namespace shmup
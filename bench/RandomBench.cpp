@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// File: RandomBench.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include <cstdlib>
+
+#include "Bench.hpp"
+#include "Random.hpp"
+
+namespace shmup {
+namespace bench {
+
+namespace {
+constexpr unsigned s_valueCount = 4096;
+
+// 별 스폰 x 좌표 범위 (화면 너비)
+constexpr float s_rangeMax = 480.0f;
+constexpr unsigned s_rangeBound = 480;
+}  // namespace
+
+void runRandomBench(Report& report) {
+  float* values = new float[s_valueCount];
+
+  // 스폰마다 하나씩 뽑는 경우
+  Random random(1);
+  report.run("random.xoshiro", "Mvalues/s", s_valueCount / 1e6, [&] {
+    for (unsigned i = 0; i < s_valueCount; ++i) {
+      values[i] = random.range(0.0f, s_rangeMax);
+    }
+    sink(values[s_valueCount - 1]);
+  });
+
+  // 한번에 여러 개를 채우는 경우 (상태를 레지스터에 둠)
+  report.run("random.fill", "Mvalues/s", s_valueCount / 1e6, [&] {
+    random.fill(values, s_valueCount, 0.0f, s_rangeMax);
+    sink(values[s_valueCount - 1]);
+  });
+
+  // 예전 스폰 코드의 rand() 식. 전역 상태라 스레드마다 나눌 수 없음
+  std::srand(1);
+  report.run("random.libc_rand", "Mvalues/s", s_valueCount / 1e6, [&] {
+    for (unsigned i = 0; i < s_valueCount; ++i) {
+      values[i] = (float)(std::rand() / ((RAND_MAX + 1u) / s_rangeBound));
+    }
+    sink(values[s_valueCount - 1]);
+  });
+
+  delete[] values;
+}
+
+}  // namespace bench
+}  // namespace shmup
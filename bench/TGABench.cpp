@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// File: TGABench.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "Bench.hpp"
+#include "TGA.hpp"
+
+namespace shmup {
+namespace bench {
+
+namespace {
+constexpr uint16_t s_imageSize = 256;
+
+/// @brief 파일을 읽지 않도록 메모리에 TGA 이미지를 만듦. 반환값은 전체 크기
+size_t makeImage(uint8_t* out, unsigned bitsPerPixel, bool topLeft) {
+  TGAHeader header = {};
+  header.image_type = 2;
+  header.width = s_imageSize;
+  header.height = s_imageSize;
+  header.pixel_depth = (uint8_t)bitsPerPixel;
+  header.image_descriptor = topLeft ? 0x20 : 0x00;
+  std::memcpy(out, &header, sizeof(header));
+
+  const size_t pixelBytes =
+      (size_t)s_imageSize * s_imageSize * (bitsPerPixel / 8);
+  for (size_t i = 0; i < pixelBytes; ++i) {
+    out[sizeof(header) + i] = (uint8_t)(i * 31);
+  }
+  return sizeof(header) + pixelBytes;
+}
+}  // namespace
+
+void runTGABench(Report& report) {
+  const size_t capacity =
+      sizeof(TGAHeader) + (size_t)s_imageSize * s_imageSize * 4;
+  uint8_t* data = new uint8_t[capacity];
+
+  // 게임 리소스와 같은 형식 (32비트, 위쪽 줄부터)
+  const size_t size32 = makeImage(data, 32, true);
+  TGA tga;
+  report.run("tga.decode_32", "MB/s", size32 / 1e6, [&] {
+    sink((unsigned)tga.decode(data, size32));
+  });
+
+  // 24비트, 아래쪽 줄부터: 픽셀마다 변환하는 느린 경로
+  const size_t size24 = makeImage(data, 24, false);
+  report.run("tga.decode_24_flipped", "MB/s", size24 / 1e6, [&] {
+    sink((unsigned)tga.decode(data, size24));
+  });
+
+  delete[] data;
+}
+
+}  // namespace bench
+}  // namespace shmup
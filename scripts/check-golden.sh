@@ -0,0 +1,29 @@
+# 골든 프레임 검사: resources/golden/replay.bin 을 헤드리스로 재생하면서
+# resources/golden/ticks 의 틱마다 화면 버퍼를 캡처하고 골든 프레임과 비교
+#
+#   sh scripts/check-golden.sh                             # 완전히 같은 픽셀만 통과
+#   sh scripts/check-golden.sh --max-error 2 --min-psnr 45  # 허용 범위 지정
+#
+# GAME, COMPARE 로 실행 파일 경로를 바꿀 수 있음 (기본값은 build/ 아래)
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+GAME=${GAME:-$ROOT/build/sdl-shmup}
+COMPARE=${COMPARE:-$ROOT/build/shmup_golden_compare}
+GOLDEN=$ROOT/resources/golden
+OPTIONS="$*"
+
+# 게임은 작업 폴더 기준 ../../resources 에서 리소스를 읽음
+WORK=$ROOT/build/golden
+rm -rf "$WORK"
+mkdir -p "$WORK"
+cd "$WORK"
+
+"$GAME" --headless --fps 0 --replay "$GOLDEN/replay.bin" \
+    --capture-dir "$WORK" --capture-ticks "$(cat "$GOLDEN/ticks")" > game.log
+
+set --
+for golden in "$GOLDEN"/tick_*.tga; do
+    set -- "$@" "$golden" "$WORK/$(basename "$golden")"
+done
+"$COMPARE" $OPTIONS "$@"
@@ -0,0 +1,25 @@
+# 골든 프레임을 다시 만듦. 렌더링 결과가 의도적으로 바뀌었을 때만 실행하고
+# 바뀐 프레임을 커밋. 입력 기록을 새로 만들려면 게임을 --record 로 실행한 뒤
+# resources/golden/replay.bin 을 교체
+#
+#   sh scripts/update-golden.sh
+#
+# GAME 으로 실행 파일 경로를 바꿀 수 있음 (기본값은 build/sdl-shmup)
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+GAME=${GAME:-$ROOT/build/sdl-shmup}
+GOLDEN=$ROOT/resources/golden
+
+# 게임은 작업 폴더 기준 ../../resources 에서 리소스를 읽음
+WORK=$ROOT/build/golden
+rm -rf "$WORK"
+mkdir -p "$WORK"
+cd "$WORK"
+
+"$GAME" --headless --fps 0 --replay "$GOLDEN/replay.bin" \
+    --capture-dir "$WORK" --capture-ticks "$(cat "$GOLDEN/ticks")" > game.log
+
+rm -f "$GOLDEN"/tick_*.tga
+cp "$WORK"/tick_*.tga "$GOLDEN"/
+ls -l "$GOLDEN"
@@ -0,0 +1,401 @@
+//------------------------------------------------------------------------------
+// File: AllocationTracker.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "AllocationTracker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if SHMUP_TRACK_ALLOCATIONS && (defined(__linux__) || defined(__APPLE__))
+#include <execinfo.h>
+#define SHMUP_HAS_BACKTRACE 1
+#else
+#define SHMUP_HAS_BACKTRACE 0
+#endif
+
+namespace shmup {
+
+#if SHMUP_TRACK_ALLOCATIONS
+
+namespace {
+
+constexpr unsigned s_maxZoneDepth = 16;
+constexpr unsigned s_maxZones = 32;
+constexpr unsigned s_maxCallSites = 256;
+constexpr unsigned s_callStackDepth = 8;
+
+// 할당 훅 안에서 다시 할당이 일어나도 집계하지 않도록 막는 플래그
+thread_local bool t_inHook = false;
+
+thread_local const char* t_zones[s_maxZoneDepth];
+thread_local unsigned t_zoneDepth = 0;
+
+std::atomic<uint64_t> s_frameAllocations{0};
+std::atomic<uint64_t> s_frameFrees{0};
+std::atomic<uint64_t> s_frameBytes{0};
+std::atomic<uint64_t> s_totalAllocations{0};
+std::atomic<uint64_t> s_totalBytes{0};
+std::atomic<size_t> s_liveBytes{0};
+std::atomic<size_t> s_peakLiveBytes{0};
+
+unsigned s_frameIndex = 0;
+unsigned s_warmupFrames = 0;
+bool s_failOnAllocation = false;
+bool s_failed = false;
+
+struct ZoneEntry {
+  const char* name;
+  uint64_t allocations;
+  uint64_t bytes;
+};
+
+struct CallSite {
+  uint64_t hash;
+  const char* zone;
+  void* frames[s_callStackDepth];
+  int frameCount;
+  uint64_t allocations;
+  uint64_t bytes;
+};
+
+// 표는 정적 메모리에만 두고 스핀락으로 보호 (훅 안에서 힙을 쓰면 안 됨)
+std::atomic_flag s_tableLock = ATOMIC_FLAG_INIT;
+ZoneEntry s_zoneTable[s_maxZones];
+CallSite s_callSites[s_maxCallSites];
+
+// 최대 깊이를 넘어 중첩되면 t_zones 에 남아 있는 가장 안쪽 존으로 분류
+const char* currentZone() {
+  if (t_zoneDepth == 0) {
+    return "(none)";
+  }
+  return t_zones[std::min(t_zoneDepth, s_maxZoneDepth) - 1];
+}
+
+void lockTables() {
+  while (s_tableLock.test_and_set(std::memory_order_acquire)) {
+  }
+}
+
+void unlockTables() { s_tableLock.clear(std::memory_order_release); }
+
+void recordZone(const char* zone, size_t size) {
+  for (unsigned i = 0; i < s_maxZones; ++i) {
+    ZoneEntry& entry = s_zoneTable[i];
+    if (entry.name == nullptr) {
+      entry.name = zone;
+    }
+    if (entry.name == zone) {
+      ++entry.allocations;
+      entry.bytes += size;
+      return;
+    }
+  }
+}
+
+void recordCallSite(const char* zone, size_t size) {
+  void* frames[s_callStackDepth + 2] = {};
+  int frameCount = 0;
+#if SHMUP_HAS_BACKTRACE
+  frameCount = backtrace(frames, s_callStackDepth + 2);
+#endif
+  // 훅 자신과 operator new 프레임은 제외
+  const int skip = (frameCount > 2) ? 2 : 0;
+
+  uint64_t hash = 1469598103934665603ull ^ (uint64_t)(uintptr_t)zone;
+  for (int i = skip; i < frameCount; ++i) {
+    hash = (hash ^ (uint64_t)(uintptr_t)frames[i]) * 1099511628211ull;
+  }
+
+  for (unsigned probe = 0; probe < s_maxCallSites; ++probe) {
+    CallSite& site = s_callSites[(hash + probe) % s_maxCallSites];
+    if (site.allocations == 0) {
+      site.hash = hash;
+      site.zone = zone;
+      site.frameCount = frameCount - skip;
+      for (int i = skip; i < frameCount; ++i) {
+        site.frames[i - skip] = frames[i];
+      }
+    }
+    if (site.hash == hash) {
+      ++site.allocations;
+      site.bytes += size;
+      return;
+    }
+  }
+}
+
+void onAllocate(size_t size) {
+  s_frameAllocations.fetch_add(1, std::memory_order_relaxed);
+  s_frameBytes.fetch_add(size, std::memory_order_relaxed);
+  s_totalAllocations.fetch_add(1, std::memory_order_relaxed);
+  s_totalBytes.fetch_add(size, std::memory_order_relaxed);
+
+  const size_t live = s_liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+  size_t peak = s_peakLiveBytes.load(std::memory_order_relaxed);
+  while (live > peak &&
+         !s_peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+
+  if (t_inHook) {
+    return;
+  }
+  t_inHook = true;
+  const char* zone = currentZone();
+  lockTables();
+  recordZone(zone, size);
+  recordCallSite(zone, size);
+  unlockTables();
+  t_inHook = false;
+}
+
+void onFree(size_t size) {
+  s_frameFrees.fetch_add(1, std::memory_order_relaxed);
+  s_liveBytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+// 사용자 포인터 바로 앞 8바이트에 요청 크기를 기록
+// 일반 할당은 16바이트, 정렬 할당은 alignment 바이트 만큼 앞에 헤더를 둔다
+constexpr size_t s_headerSize = 16;
+
+void* trackedAllocate(size_t size, size_t header, size_t alignment) {
+  const size_t total = size + header;
+  uint8_t* base = nullptr;
+  if (alignment <= s_headerSize) {
+    base = (uint8_t*)malloc(total);
+  } else {
+#if _WIN32
+    base = (uint8_t*)_aligned_malloc(total, alignment);
+#else
+    base = (uint8_t*)aligned_alloc(alignment, (total + alignment - 1) / alignment * alignment);
+#endif
+  }
+  if (base == nullptr) {
+    return nullptr;
+  }
+  uint8_t* user = base + header;
+  ((size_t*)user)[-1] = size;
+  onAllocate(size);
+  return user;
+}
+
+void trackedFree(void* ptr, size_t header, size_t alignment) {
+  if (ptr == nullptr) {
+    return;
+  }
+  uint8_t* user = (uint8_t*)ptr;
+  onFree(((size_t*)user)[-1]);
+  uint8_t* base = user - header;
+  if (alignment <= s_headerSize) {
+    free(base);
+  } else {
+#if _WIN32
+    _aligned_free(base);
+#else
+    free(base);
+#endif
+  }
+}
+
+}  // namespace
+
+bool AllocationTracker::enabled() { return true; }
+
+void AllocationTracker::beginFrame() {
+  ++s_frameIndex;
+  s_frameAllocations.store(0, std::memory_order_relaxed);
+  s_frameFrees.store(0, std::memory_order_relaxed);
+  s_frameBytes.store(0, std::memory_order_relaxed);
+}
+
+void AllocationTracker::endFrame() {
+  if (s_frameIndex <= s_warmupFrames) {
+    return;
+  }
+  const AllocationStats stats = frameStats();
+  if (stats.allocations == 0) {
+    return;
+  }
+  printf("[alloc] frame %u: %llu allocs, %llu frees, %llu bytes, live %zu bytes\n",
+         s_frameIndex, (unsigned long long)stats.allocations,
+         (unsigned long long)stats.frees, (unsigned long long)stats.bytes,
+         liveBytes());
+  if (s_failOnAllocation) {
+    s_failed = true;
+  }
+}
+
+AllocationStats AllocationTracker::frameStats() {
+  return {s_frameAllocations.load(std::memory_order_relaxed),
+          s_frameFrees.load(std::memory_order_relaxed),
+          s_frameBytes.load(std::memory_order_relaxed)};
+}
+
+size_t AllocationTracker::liveBytes() {
+  return s_liveBytes.load(std::memory_order_relaxed);
+}
+
+size_t AllocationTracker::peakLiveBytes() {
+  return s_peakLiveBytes.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::failOnAllocationAfter(unsigned warmupFrames) {
+  s_warmupFrames = warmupFrames;
+  s_failOnAllocation = true;
+}
+
+bool AllocationTracker::failed() { return s_failed; }
+
+void AllocationTracker::report(unsigned topCount) {
+  t_inHook = true;
+  lockTables();
+
+  printf("[alloc] total %llu allocs, %llu bytes, peak live %zu bytes\n",
+         (unsigned long long)s_totalAllocations.load(),
+         (unsigned long long)s_totalBytes.load(), peakLiveBytes());
+
+  for (unsigned i = 0; i < s_maxZones && s_zoneTable[i].name != nullptr; ++i) {
+    printf("[alloc] zone %-20s %8llu allocs %10llu bytes\n", s_zoneTable[i].name,
+           (unsigned long long)s_zoneTable[i].allocations,
+           (unsigned long long)s_zoneTable[i].bytes);
+  }
+
+  // 바이트 기준 상위 호출 위치를 하나씩 골라 출력 (정렬용 메모리를 쓰지 않음)
+  bool printed[s_maxCallSites] = {};
+  for (unsigned n = 0; n < topCount; ++n) {
+    int best = -1;
+    for (unsigned i = 0; i < s_maxCallSites; ++i) {
+      if (printed[i] || s_callSites[i].allocations == 0) continue;
+      if (best < 0 || s_callSites[i].bytes > s_callSites[best].bytes) {
+        best = (int)i;
+      }
+    }
+    if (best < 0) break;
+    printed[best] = true;
+
+    const CallSite& site = s_callSites[best];
+    printf("[alloc] #%u zone %s: %llu allocs, %llu bytes\n", n + 1, site.zone,
+           (unsigned long long)site.allocations, (unsigned long long)site.bytes);
+    fflush(stdout);
+#if SHMUP_HAS_BACKTRACE
+    backtrace_symbols_fd(site.frames, site.frameCount, fileno(stdout));
+#endif
+  }
+
+  unlockTables();
+  t_inHook = false;
+}
+
+void AllocationTracker::pushZone(const char* name) {
+  if (t_zoneDepth < s_maxZoneDepth) {
+    t_zones[t_zoneDepth] = name;
+  }
+  ++t_zoneDepth;
+}
+
+void AllocationTracker::popZone() {
+  if (t_zoneDepth > 0) {
+    --t_zoneDepth;
+  }
+}
+
+#else  // SHMUP_TRACK_ALLOCATIONS
+
+bool AllocationTracker::enabled() { return false; }
+void AllocationTracker::beginFrame() {}
+void AllocationTracker::endFrame() {}
+AllocationStats AllocationTracker::frameStats() { return {0, 0, 0}; }
+size_t AllocationTracker::liveBytes() { return 0; }
+size_t AllocationTracker::peakLiveBytes() { return 0; }
+void AllocationTracker::failOnAllocationAfter(unsigned) {}
+bool AllocationTracker::failed() { return false; }
+void AllocationTracker::report(unsigned) {}
+void AllocationTracker::pushZone(const char*) {}
+void AllocationTracker::popZone() {}
+
+#endif  // SHMUP_TRACK_ALLOCATIONS
+
+}  // namespace shmup
+
+#if SHMUP_TRACK_ALLOCATIONS
+
+// 전역 operator new/delete 교체
+void* operator new(size_t size) {
+  void* p = shmup::trackedAllocate(size, shmup::s_headerSize, 0);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t size) {
+  void* p = shmup::trackedAllocate(size, shmup::s_headerSize, 0);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return shmup::trackedAllocate(size, shmup::s_headerSize, 0);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return shmup::trackedAllocate(size, shmup::s_headerSize, 0);
+}
+
+void* operator new(size_t size, std::align_val_t align) {
+  const size_t a = (size_t)align;
+  void* p = shmup::trackedAllocate(size, a > shmup::s_headerSize ? a : shmup::s_headerSize, a);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t size, std::align_val_t align) {
+  return operator new(size, align);
+}
+
+void operator delete(void* ptr) noexcept {
+  shmup::trackedFree(ptr, shmup::s_headerSize, 0);
+}
+
+void operator delete[](void* ptr) noexcept {
+  shmup::trackedFree(ptr, shmup::s_headerSize, 0);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  shmup::trackedFree(ptr, shmup::s_headerSize, 0);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+  shmup::trackedFree(ptr, shmup::s_headerSize, 0);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  shmup::trackedFree(ptr, shmup::s_headerSize, 0);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  shmup::trackedFree(ptr, shmup::s_headerSize, 0);
+}
+
+void operator delete(void* ptr, std::align_val_t align) noexcept {
+  const size_t a = (size_t)align;
+  shmup::trackedFree(ptr, a > shmup::s_headerSize ? a : shmup::s_headerSize, a);
+}
+
+void operator delete[](void* ptr, std::align_val_t align) noexcept {
+  operator delete(ptr, align);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t align) noexcept {
+  operator delete(ptr, align);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t align) noexcept {
+  operator delete(ptr, align);
+}
+
+#endif  // SHMUP_TRACK_ALLOCATIONS
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// File: AllocationTracker.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace shmup {
+
+/// @brief 한 프레임 동안의 힙 할당 집계
+struct AllocationStats {
+  uint64_t allocations;
+  uint64_t frees;
+  uint64_t bytes;
+};
+
+/// @brief 전역 operator new/delete를 가로채서 프레임 단위로 힙 할당을 집계.
+/// SHMUP_TRACK_ALLOCATIONS 로 빌드했을 때만 가로채며, 그렇지 않으면 모든 값은 0.
+/// - 할당은 현재 AllocationZone 이름으로 분류됨
+/// - 호출 위치는 콜스택을 캡처해서 같은 스택끼리 묶음
+/// - 워밍업 이후 할당이 한번이라도 생기면 failed()가 true
+class AllocationTracker {
+ public:
+  static bool enabled();
+
+  /// @brief 프레임 시작. 프레임 카운터 증가 및 프레임 집계 초기화
+  static void beginFrame();
+
+  /// @brief 프레임 끝. 워밍업 이후 할당이 있었다면 한 줄 리포트 출력
+  static void endFrame();
+
+  static AllocationStats frameStats();
+
+  static size_t liveBytes();
+
+  static size_t peakLiveBytes();
+
+  /// @brief 워밍업 프레임 수 이후로 할당이 생기면 실패로 기록
+  static void failOnAllocationAfter(unsigned warmupFrames);
+
+  static bool failed();
+
+  /// @brief 전체 요약과 가장 많이 할당한 호출 위치 출력
+  static void report(unsigned topCount = 10);
+
+  static void pushZone(const char* name);
+
+  static void popZone();
+};
+
+/// @brief 스코프 동안의 할당을 주어진 이름으로 분류 (프로파일러 존)
+class AllocationZone {
+ public:
+  explicit AllocationZone(const char* name) { AllocationTracker::pushZone(name); }
+
+  ~AllocationZone() { AllocationTracker::popZone(); }
+
+  AllocationZone(const AllocationZone&) = delete;
+  AllocationZone& operator=(const AllocationZone&) = delete;
+};
+
+}  // namespace shmup
@@ -37,6 +37,12 @@ RGBA Blend::alpha(const RGBA& src, const RGBA& dst) {
   return retValue;
 }
 
+void Blend::alphaSpan(const RGBA* src, RGBA* dst, unsigned count) {
+  for (unsigned i = 0; i < count; ++i) {
+    dst[i] = alpha(src[i], dst[i]);
+  }
+}
+
 /// color pre-multiplied alpha Blend
 /// 소스 RGB에 이미 소스 알파값이 적용되어 있음을 전제
 /// dstRGB = srcRGB + (dstRGB * (1-srcA))
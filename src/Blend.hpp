@@ -25,6 +25,9 @@ static uint8_t normalizeToByte(float colorValue);
 /// dstA = srcA + (dstA * (1-srcA))
 static RGBA alpha(const RGBA& src, const RGBA& dst);
 
+/// 한 줄(span) 알파 블렌딩: dst[i] = alpha(src[i], dst[i])
+static void alphaSpan(const RGBA* src, RGBA* dst, unsigned count);
+
 /// color pre-multiplied alpha Blend
 /// 소스 RGB에 이미 소스 알파값이 적용되어 있음을 전제
 /// dstRGB = srcRGB + (dstRGB * (1-srcA))
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "GameObject.hpp"
 
 namespace shmup {
@@ -19,18 +21,7 @@ enum BulletState {
 class Bullet : public GameObject {
 public:
   Bullet();
-  
-  ~Bullet();
-
-  void onCollided(const GameObject& target) override;
-
-  Vector2 nextPos(double delta) const;
-
-  /// @brief 만약 움직이고 있다면 주어진 시간의 예상되는 콜라이더 중심 좌표 반환.
-  /// 만약 움직이도록 설정되지 않았거나 목적지에 위치해 있다면 현재 위치 반환. 
-  Vector2 getColliderCenterByDelta(double delta) const;
 
-public:
   void speed(float speed);
   
   float speed() const;
@@ -39,8 +30,6 @@ public:
 
   BulletState state() const;
 
-  Vector2* debugPoints() const;
-
   void destination(Vector2 pos) { m_destination = pos; }
   
   Vector2 destination() const {  return m_destination; }
@@ -50,9 +39,11 @@ private:
   
   float m_speed;
 
-  Vector2* m_debugPoints = nullptr;
-
   Vector2 m_destination;
 };
 
+// 풀에서 memcpy로 옮길 수 있어야 함
+static_assert(std::is_trivially_copyable_v<Bullet>,
+              "Bullet must stay trivially copyable");
+
 }
\ No newline at end of file
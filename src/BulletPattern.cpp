@@ -0,0 +1,287 @@
+//------------------------------------------------------------------------------
+// File: BulletPattern.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "BulletPattern.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <iostream>
+
+#include "JobSystem.hpp"
+#include "Simd.hpp"
+#include "Snapshot.hpp"
+
+namespace shmup {
+
+namespace {
+// 한 잡이 갱신하는 탄 수
+constexpr unsigned s_updateGrain = 4096;
+}
+
+PatternEngine::PatternEngine() {}
+
+PatternEngine::~PatternEngine() {
+  // 모든 컬럼은 한 블록에서 잘라 쓰므로 첫 컬럼만 해제
+  delete[] m_originX;
+}
+
+bool PatternEngine::init(unsigned capacity, float tick, float width,
+                         float height, float margin) {
+  // 모든 컬럼을 한번에 할당
+  constexpr unsigned columnCount = s_columnCount;
+  float* block = new float[(size_t)capacity * columnCount];
+  if (block == nullptr) {
+    std::cout << "PatternEngine allocate columns failed \n";
+    return false;
+  }
+
+  float** columns[columnCount] = {
+      &m_originX, &m_originY, &m_dirX,   &m_dirY,  &m_rotCos,
+      &m_rotSin,  &m_radius,  &m_speed,  &m_acceleration,
+      &m_posX,    &m_posY,    &m_prevX,  &m_prevY};
+  for (unsigned i = 0; i < columnCount; ++i) {
+    *columns[i] = block + (size_t)capacity * i;
+  }
+
+  m_capacity = capacity;
+  m_count = 0;
+  m_tick = tick;
+  m_minX = -margin, m_minY = -margin;
+  m_maxX = width + margin, m_maxY = height + margin;
+  return true;
+}
+
+void PatternEngine::spawn(const Vector2& origin, float angle,
+                          const PatternDesc& desc) {
+  if (m_count >= m_capacity) {
+    return;
+  }
+  const unsigned i = m_count++;
+  const float rotation = desc.angularVelocity * m_tick;
+
+  m_originX[i] = origin.x, m_originY[i] = origin.y;
+  m_dirX[i] = std::cos(angle), m_dirY[i] = std::sin(angle);
+  m_rotCos[i] = std::cos(rotation), m_rotSin[i] = std::sin(rotation);
+  m_radius[i] = 0.0f;
+  m_speed[i] = desc.speed;
+  m_acceleration[i] = desc.acceleration;
+  m_posX[i] = m_prevX[i] = origin.x;
+  m_posY[i] = m_prevY[i] = origin.y;
+}
+
+void PatternEngine::emit(const PatternDesc& desc, const Vector2& origin,
+                         const Vector2& target) {
+  if (desc.count == 0) {
+    return;
+  }
+
+  switch (desc.type) {
+  case PatternRadial:
+  case PatternSpiral: {
+    const float step = 6.28318531f / desc.count;  // 2π / N
+    for (unsigned i = 0; i < desc.count; ++i) {
+      spawn(origin, desc.startAngle + step * i, desc);
+    }
+    break;
+  }
+  case PatternAimed: {
+    const Vector2 toTarget = target - origin;
+    const float center = std::atan2(toTarget.y, toTarget.x);
+    if (desc.count == 1) {
+      spawn(origin, center, desc);
+      break;
+    }
+    const float step = desc.spread / (desc.count - 1);
+    const float first = center - desc.spread * 0.5f;
+    for (unsigned i = 0; i < desc.count; ++i) {
+      spawn(origin, first + step * i, desc);
+    }
+    break;
+  }
+  }
+}
+
+void PatternEngine::update(JobSystem* jobs) {
+  bool anyOut = false;
+  if (jobs == nullptr) {
+    anyOut = updateRange(0, m_count);
+  } else {
+    // SIMD 폭 단위로 나눠서 구간 경계에서도 스칼라 처리가 생기지 않게 함
+    std::atomic<bool> anyOutShared{false};
+    const unsigned blockCount = (m_count + simd::s_width - 1) / simd::s_width;
+    jobs->parallelFor(0, blockCount, s_updateGrain / simd::s_width,
+                      [&](unsigned first, unsigned last) {
+                        const unsigned end = last * simd::s_width;
+                        if (updateRange(first * simd::s_width,
+                                        end < m_count ? end : m_count)) {
+                          anyOutShared.store(true, std::memory_order_relaxed);
+                        }
+                      });
+    anyOut = anyOutShared.load(std::memory_order_relaxed);
+  }
+
+  // 화면 밖으로 나간 탄이 있을 때만 압축
+  if (anyOut) {
+    compact();
+  }
+}
+
+bool PatternEngine::updateRange(unsigned begin, unsigned end) {
+  using namespace simd;
+
+  const float4 tick = set1(m_tick);
+  const float4 minX = set1(m_minX), maxX = set1(m_maxX);
+  const float4 minY = set1(m_minY), maxY = set1(m_maxY);
+
+  bool anyOut = false;
+  unsigned i = begin;
+  for (; i + s_width <= end; i += s_width) {
+    // 이전 위치 기록
+    const float4 posX = load(m_posX + i), posY = load(m_posY + i);
+    store(m_prevX + i, posX);
+    store(m_prevY + i, posY);
+
+    // 방향 회전: (x c - y s, x s + y c)
+    const float4 dirX = load(m_dirX + i), dirY = load(m_dirY + i);
+    const float4 c = load(m_rotCos + i), s = load(m_rotSin + i);
+    const float4 newDirX = sub(mul(dirX, c), mul(dirY, s));
+    const float4 newDirY = madd(dirX, s, mul(dirY, c));
+    store(m_dirX + i, newDirX);
+    store(m_dirY + i, newDirY);
+
+    // 반지름과 속도 적분
+    const float4 speed = load(m_speed + i);
+    const float4 radius = madd(speed, tick, load(m_radius + i));
+    store(m_radius + i, radius);
+    store(m_speed + i, madd(load(m_acceleration + i), tick, speed));
+
+    // 위치 = origin + direction * radius
+    const float4 newX = madd(newDirX, radius, load(m_originX + i));
+    const float4 newY = madd(newDirY, radius, load(m_originY + i));
+    store(m_posX + i, newX);
+    store(m_posY + i, newY);
+
+    if (anyOutside(newX, minX, maxX) || anyOutside(newY, minY, maxY)) {
+      anyOut = true;
+    }
+  }
+
+  // 4개 단위로 떨어지지 않는 나머지는 스칼라로 처리
+  for (; i < end; ++i) {
+    m_prevX[i] = m_posX[i], m_prevY[i] = m_posY[i];
+    const float dirX = m_dirX[i] * m_rotCos[i] - m_dirY[i] * m_rotSin[i];
+    const float dirY = m_dirX[i] * m_rotSin[i] + m_dirY[i] * m_rotCos[i];
+    m_dirX[i] = dirX, m_dirY[i] = dirY;
+    m_radius[i] += m_speed[i] * m_tick;
+    m_speed[i] += m_acceleration[i] * m_tick;
+    m_posX[i] = m_originX[i] + dirX * m_radius[i];
+    m_posY[i] = m_originY[i] + dirY * m_radius[i];
+    if (isInside(i) == false) {
+      anyOut = true;
+    }
+  }
+  return anyOut;
+}
+
+unsigned PatternEngine::collide(const Vector2& center, float radius) {
+  using namespace simd;
+
+  const float4 cx = set1(center.x), cy = set1(center.y);
+  const float4 radiusSq = set1(radius * radius);
+  const float radiusSqScalar = radius * radius;
+
+  // 먼저 SIMD로 겹치는 탄이 있는지만 확인
+  bool anyHit = false;
+  unsigned i = 0;
+  for (; i + s_width <= m_count && anyHit == false; i += s_width) {
+    const float4 dx = sub(load(m_posX + i), cx);
+    const float4 dy = sub(load(m_posY + i), cy);
+    anyHit = anyLess(madd(dx, dx, mul(dy, dy)), radiusSq);
+  }
+  for (; i < m_count && anyHit == false; ++i) {
+    const float dx = m_posX[i] - center.x, dy = m_posY[i] - center.y;
+    anyHit = dx * dx + dy * dy < radiusSqScalar;
+  }
+  if (anyHit == false) {
+    return 0;
+  }
+
+  // 겹친 탄을 제거하면서 나머지를 앞으로 모음
+  unsigned hits = 0;
+  unsigned write = 0;
+  for (unsigned read = 0; read < m_count; ++read) {
+    const float dx = m_posX[read] - center.x, dy = m_posY[read] - center.y;
+    if (dx * dx + dy * dy < radiusSqScalar) {
+      ++hits;
+      continue;
+    }
+    if (write != read) {
+      copy(write, read);
+    }
+    ++write;
+  }
+  m_count = write;
+  return hits;
+}
+
+size_t PatternEngine::snapshotCapacity() const {
+  return sizeof(m_count) + sizeof(float) * s_columnCount * m_capacity;
+}
+
+void PatternEngine::save(SnapshotWriter& writer) const {
+  const float* columns[s_columnCount] = {
+      m_originX, m_originY, m_dirX,  m_dirY,  m_rotCos,
+      m_rotSin,  m_radius,  m_speed, m_acceleration,
+      m_posX,    m_posY,    m_prevX, m_prevY};
+  writer.write(m_count);
+  for (const float* column : columns) {
+    writer.writeArray(column, m_count);
+  }
+}
+
+void PatternEngine::restore(SnapshotReader& reader) {
+  float* columns[s_columnCount] = {
+      m_originX, m_originY, m_dirX,  m_dirY,  m_rotCos,
+      m_rotSin,  m_radius,  m_speed, m_acceleration,
+      m_posX,    m_posY,    m_prevX, m_prevY};
+  reader.read(&m_count);
+  for (float* column : columns) {
+    reader.readArray(column, m_count);
+  }
+}
+
+void PatternEngine::compact() {
+  unsigned write = 0;
+  for (unsigned read = 0; read < m_count; ++read) {
+    if (isInside(read) == false) {
+      continue;
+    }
+    if (write != read) {
+      copy(write, read);
+    }
+    ++write;
+  }
+  m_count = write;
+}
+
+bool PatternEngine::isInside(unsigned index) const {
+  return m_posX[index] >= m_minX && m_posX[index] <= m_maxX &&
+         m_posY[index] >= m_minY && m_posY[index] <= m_maxY;
+}
+
+void PatternEngine::copy(unsigned to, unsigned from) {
+  m_originX[to] = m_originX[from], m_originY[to] = m_originY[from];
+  m_dirX[to] = m_dirX[from], m_dirY[to] = m_dirY[from];
+  m_rotCos[to] = m_rotCos[from], m_rotSin[to] = m_rotSin[from];
+  m_radius[to] = m_radius[from];
+  m_speed[to] = m_speed[from];
+  m_acceleration[to] = m_acceleration[from];
+  m_posX[to] = m_posX[from], m_posY[to] = m_posY[from];
+  m_prevX[to] = m_prevX[from], m_prevY[to] = m_prevY[from];
+}
+
+}  // namespace shmup
@@ -0,0 +1,137 @@
+//------------------------------------------------------------------------------
+// File: BulletPattern.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+
+#include "Math.hpp"
+
+namespace shmup {
+
+class JobSystem;
+class SnapshotReader;
+class SnapshotWriter;
+
+enum PatternType {
+  PatternRadial,  // 원형으로 고르게 퍼지는 탄
+  PatternSpiral,  // 퍼지면서 회전하는 탄
+  PatternAimed,   // 목표를 향해 부채꼴로 쏘는 탄
+};
+
+/// @brief 한번의 발사(볼리)를 설명하는 값
+struct PatternDesc {
+  PatternType type;
+  unsigned count;         // 탄 개수
+  float speed;            // 밀리초당 이동 거리
+  float acceleration;     // 밀리초당 속도 변화
+  float angularVelocity;  // 밀리초당 회전 각도 (라디안). 스파이럴에서 사용
+  float startAngle;       // 첫 탄의 각도 (라디안). 조준탄은 무시
+  float spread;           // 조준탄 부채꼴 전체 각도 (라디안)
+};
+
+/// @brief 탄막 패턴 엔진. 탄마다 궤적 파라미터만 저장하고 위치는 고정 틱마다
+/// 전체 탄을 SIMD로 한번에 계산한다.
+///
+/// 각 탄의 궤적: position = origin + direction * radius
+///  - direction 은 틱마다 탄별 회전 상수(cos, sin)만큼 회전
+///  - radius += speed * tick, speed += acceleration * tick
+/// 회전 상수는 발사할 때 한번 계산하므로 갱신에는 삼각함수가 필요 없다.
+///
+/// 컬럼(SoA)은 [0, count) 구간에 빽빽하게 유지되며, 화면 밖으로 나간 탄은
+/// 갱신 후에 한번에 압축해서 제거한다.
+class PatternEngine {
+ public:
+  PatternEngine();
+
+  ~PatternEngine();
+
+  PatternEngine(const PatternEngine&) = delete;
+  PatternEngine& operator=(const PatternEngine&) = delete;
+
+  /// @brief 컬럼을 용량만큼 미리 할당.
+  /// @param tick 고정 틱 길이(ms). 회전 상수 계산에 사용
+  /// @param width, height 이 영역에서 margin 만큼 벗어난 탄은 제거
+  bool init(unsigned capacity, float tick, float width, float height,
+            float margin);
+
+  /// @brief origin 에서 패턴 발사. 조준탄은 target 을 향함. 용량이 차면 남는 탄은 버림
+  void emit(const PatternDesc& desc, const Vector2& origin,
+            const Vector2& target);
+
+  /// @brief 한 틱 진행. 이전 위치를 기록하고 새 위치를 계산한 뒤 화면 밖 탄 제거.
+  /// jobs 가 있으면 탄 구간을 나눠서 병렬로 계산하고 제거만 한 스레드에서 함
+  void update(JobSystem* jobs = nullptr);
+
+  /// @brief center 에서 radius 안에 들어온 탄을 제거하고 그 개수를 반환
+  unsigned collide(const Vector2& center, float radius);
+
+  void clear() { m_count = 0; }
+
+  unsigned count() const { return m_count; }
+
+  unsigned capacity() const { return m_capacity; }
+
+  /// @brief 탄 중심 좌표 컬럼
+  const float* positionsX() const { return m_posX; }
+
+  const float* positionsY() const { return m_posY; }
+
+  /// @brief 직전 틱의 탄 중심 좌표 컬럼. 렌더링 보간에 사용
+  const float* previousPositionsX() const { return m_prevX; }
+
+  const float* previousPositionsY() const { return m_prevY; }
+
+  /// @brief save() 가 쓰는 최대 바이트 수
+  size_t snapshotCapacity() const;
+
+  /// @brief 살아있는 탄의 컬럼만 기록. 용량과 영역은 init 에서 정해지므로 기록하지 않음
+  void save(SnapshotWriter& writer) const;
+
+  void restore(SnapshotReader& reader);
+
+ private:
+  void spawn(const Vector2& origin, float angle, const PatternDesc& desc);
+
+  /// @brief [begin, end) 탄을 한 틱 진행. 영역을 벗어난 탄이 있으면 true
+  bool updateRange(unsigned begin, unsigned end);
+
+  /// @brief 살아있는 탄만 앞으로 모음
+  void compact();
+
+  bool isInside(unsigned index) const;
+
+  void copy(unsigned to, unsigned from);
+
+ private:
+  static constexpr unsigned s_columnCount = 13;
+
+  unsigned m_count = 0;
+
+  unsigned m_capacity = 0;
+
+  float m_tick = 0.0f;
+
+  // 탄이 살아있을 수 있는 영역
+  float m_minX = 0.0f, m_minY = 0.0f, m_maxX = 0.0f, m_maxY = 0.0f;
+
+  float* m_originX = nullptr;
+  float* m_originY = nullptr;
+  float* m_dirX = nullptr;
+  float* m_dirY = nullptr;
+  float* m_rotCos = nullptr;
+  float* m_rotSin = nullptr;
+  float* m_radius = nullptr;
+  float* m_speed = nullptr;
+  float* m_acceleration = nullptr;
+  float* m_posX = nullptr;
+  float* m_posY = nullptr;
+  float* m_prevX = nullptr;
+  float* m_prevY = nullptr;
+};
+
+}  // namespace shmup
@@ -16,4 +16,11 @@ struct CircleCollider {
   float radius;
 };
 
+/// @brief 두 원이 겹치는지 검사. 제곱 거리로 비교해서 sqrt 를 쓰지 않음
+constexpr bool circlesOverlap(const Vector2& a, float radiusA, const Vector2& b,
+                              float radiusB) {
+  const float radiusSum = radiusA + radiusB;
+  return Math::distanceSq(a, b) <= radiusSum * radiusSum;
+}
+
 }  // namespace shmup
\ No newline at end of file
@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// File: DrawList.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "DrawList.hpp"
+
+namespace shmup {
+
+void DrawLists::begin(FrameArena* arena, float viewportWidth,
+                      float viewportHeight) {
+  m_arena = arena;
+  m_viewportWidth = viewportWidth;
+  m_viewportHeight = viewportHeight;
+  for (unsigned l = 0; l < DrawLayerCount; ++l) {
+    m_layers[l] = {};
+    m_culledCounts[l] = 0;
+  }
+}
+
+void DrawLists::end() {
+  for (DrawList& list : m_layers) {
+    m_arena->deallocate(list.items);
+    list = {};
+  }
+}
+
+unsigned DrawLists::culledCount() const {
+  unsigned count = 0;
+  for (unsigned culled : m_culledCounts) {
+    count += culled;
+  }
+  return count;
+}
+
+DrawList& DrawLists::reserve(DrawLayer layer, const TGA& texture,
+                             unsigned capacity) {
+  DrawList& list = m_layers[layer];
+  list.texture = &texture;
+  list.items = capacity ? m_arena->allocateArray<DrawItem>(capacity) : nullptr;
+  list.count = 0;
+  return list;
+}
+
+void DrawLists::addPlayer(const Player& player, float alpha) {
+  DrawList& list = reserve(DrawLayerPlayer, player.planeTexture(), 1);
+  const Vector2 pos = player.interpolatedPosition(alpha);
+  push(list, pos.x, pos.y, player.size().x, player.size().y);
+}
+
+void DrawLists::addBullets(const TGA& texture,
+                           const ObjectPool<Bullet>& bullets, float alpha) {
+  DrawList& list = reserve(DrawLayerBullets, texture, bullets.liveCount());
+  for (unsigned i = 0; i < bullets.liveCount(); ++i) {
+    const Bullet& bullet = bullets.live(i);
+    const Vector2 pos = bullet.interpolatedPosition(alpha);
+    push(list, pos.x, pos.y, bullet.size().x, bullet.size().y);
+  }
+}
+
+void DrawLists::addArchetype(DrawLayer layer, const TGA& texture,
+                             const Archetype& archetype, float alpha) {
+  DrawList& list = reserve(layer, texture, archetype.count);
+  // 보간은 항목을 채우는 루프 안에서 바로 함. 따로 배열에 구해 두면
+  // 임시 버퍼와 한번 더 도는 비용이 보간 자체보다 큼
+  for (unsigned i = 0; i < archetype.count; ++i) {
+    const Vector2 position = Math::lerp(archetype.previousPositions[i],
+                                        archetype.positions[i], alpha);
+    push(list, position.x, position.y, archetype.sizes[i].x,
+         archetype.sizes[i].y);
+  }
+}
+
+void DrawLists::addPatterns(const TGA& texture,
+                            const PatternEngine& patterns, float alpha) {
+  DrawList& list = reserve(DrawLayerPatternBullets, texture, patterns.count());
+  const float w = (float)texture.header()->width;
+  const float h = (float)texture.header()->height;
+  const float* x = patterns.positionsX();
+  const float* y = patterns.positionsY();
+  const float* prevX = patterns.previousPositionsX();
+  const float* prevY = patterns.previousPositionsY();
+  for (unsigned i = 0; i < patterns.count(); ++i) {
+    push(list, prevX[i] + (x[i] - prevX[i]) * alpha - w / 2,
+         prevY[i] + (y[i] - prevY[i]) * alpha - h / 2, w, h);
+  }
+}
+
+}  // namespace shmup
@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+// File: DrawList.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include "BulletPattern.hpp"
+#include "ECS.hpp"
+#include "FrameArena.hpp"
+#include "ObjectPool.hpp"
+#include "Player.hpp"
+#include "TGA.hpp"
+
+namespace shmup {
+
+/// 그리는 순서대로 나열한 레이어
+enum DrawLayer {
+  DrawLayerStars,
+  DrawLayerPlayer,
+  DrawLayerBullets,
+  DrawLayerEnemies,
+  DrawLayerPatternBullets,
+  DrawLayerCount,
+};
+
+/// @brief 화면 좌표의 사각형 하나 (보간까지 끝난 위치)
+struct DrawItem {
+  float x, y, w, h;
+};
+
+/// @brief 한 레이어에서 실제로 화면에 보이는 것만 담은 목록. 모두 같은 텍스처를 씀
+struct DrawList {
+  const TGA* texture;
+  DrawItem* items;
+  unsigned count;
+};
+
+/// @brief 프레임마다 레이어별 그리기 목록을 만듦.
+/// 각 소스의 살아있는 항목을 보간한 위치로 뷰포트와 비교해서 보이는 것만 남기므로,
+/// 렌더러는 풀 용량이나 화면 밖 오브젝트와 상관없이 목록만 순회하면 된다.
+/// 목록 메모리는 프레임 아레나에서 받으며 end() 이후에는 사용할 수 없음.
+/// 레이어마다 쓰는 상태가 따로라서 서로 다른 레이어의 add 는 동시에 호출해도 됨.
+class DrawLists {
+ public:
+  void begin(FrameArena* arena, float viewportWidth, float viewportHeight);
+
+  /// @brief 아레나를 넘쳐서 힙에서 받은 목록이 있으면 돌려줌
+  void end();
+
+  void addPlayer(const Player& player, float alpha);
+
+  void addBullets(const TGA& texture,
+                  const ObjectPool<Bullet>& bullets, float alpha);
+
+  /// @brief 아키타입의 [0, count) 구간을 추가. 위치는 왼쪽 위 기준
+  void addArchetype(DrawLayer layer, const TGA& texture,
+                    const Archetype& archetype, float alpha);
+
+  /// @brief 탄막 추가. 탄 좌표는 중심이므로 텍스처 크기의 절반만큼 옮김
+  void addPatterns(const TGA& texture, const PatternEngine& patterns,
+                   float alpha);
+
+  const DrawList& layer(DrawLayer layer) const { return m_layers[layer]; }
+
+  /// @brief 이번 프레임에 뷰포트 밖이라서 빠진 개수
+  unsigned culledCount() const;
+
+ private:
+  /// @brief 레이어 목록을 capacity 만큼 할당
+  DrawList& reserve(DrawLayer layer, const TGA& texture,
+                    unsigned capacity);
+
+  void push(DrawList& list, float x, float y, float w, float h) {
+    if (x + w <= 0.0f || x >= m_viewportWidth || y + h <= 0.0f ||
+        y >= m_viewportHeight) {
+      ++m_culledCounts[&list - m_layers];
+      return;
+    }
+    list.items[list.count++] = {x, y, w, h};
+  }
+
+ private:
+  FrameArena* m_arena = nullptr;
+
+  DrawList m_layers[DrawLayerCount] = {};
+
+  float m_viewportWidth = 0.0f;
+
+  float m_viewportHeight = 0.0f;
+
+  unsigned m_culledCounts[DrawLayerCount] = {};
+};
+
+}  // namespace shmup
@@ -0,0 +1,310 @@
+//------------------------------------------------------------------------------
+// File: ECS.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "ECS.hpp"
+
+#include <iostream>
+#include <limits>
+
+#include "JobSystem.hpp"
+#include "Simd.hpp"
+#include "Snapshot.hpp"
+
+namespace shmup {
+
+namespace {
+constexpr uint32_t s_noFreeSlot = 0xFFFFFFFFu;
+
+/// 아키타입 한 행의 컴포넌트를 모두 합친 크기
+size_t rowSize(const Archetype& a) {
+  size_t size = sizeof(Entity);
+  if (a.positions) size += sizeof(Vector2) * 2;
+  if (a.velocities) size += sizeof(Vector2);
+  if (a.sizes) size += sizeof(Vector2);
+  if (a.colliders) size += sizeof(CircleCollider);
+  if (a.sprites) size += sizeof(SpriteId);
+  if (a.lifetimes) size += sizeof(float);
+  return size;
+}
+}  // namespace
+
+Registry::Registry() {}
+
+Registry::~Registry() {
+  for (unsigned i = 0; i < m_archetypeCount; ++i) {
+    Archetype& a = m_archetypes[i];
+    delete[] a.entities;
+    delete[] a.positions;
+    delete[] a.previousPositions;
+    delete[] a.velocities;
+    delete[] a.sizes;
+    delete[] a.colliders;
+    delete[] a.sprites;
+    delete[] a.lifetimes;
+  }
+  delete[] m_slots;
+}
+
+bool Registry::init(unsigned maxEntities) {
+  m_slots = new EntitySlot[maxEntities];
+  if (m_slots == nullptr) {
+    std::cout << "Registry allocate entity table failed \n";
+    return false;
+  }
+  m_slotCount = maxEntities;
+
+  // 모든 슬롯을 프리 리스트로 연결
+  for (unsigned i = 0; i < m_slotCount; ++i) {
+    m_slots[i] = {0, 0, 0, (i + 1 < m_slotCount) ? i + 1 : s_noFreeSlot};
+  }
+  m_freeHead = (m_slotCount > 0) ? 0 : s_noFreeSlot;
+  return true;
+}
+
+Archetype* Registry::createArchetype(ComponentMask mask, unsigned capacity) {
+  Archetype* existing = archetype(mask);
+  if (existing != nullptr) {
+    return existing;
+  }
+
+  if (m_archetypeCount >= s_maxArchetypes) {
+    std::cout << "Registry archetype limit reached \n";
+    return nullptr;
+  }
+
+  Archetype& a = m_archetypes[m_archetypeCount++];
+  a.mask = mask;
+  a.count = 0;
+  a.capacity = capacity;
+  a.entities = new Entity[capacity];
+  if (mask & ComponentPosition) {
+    a.positions = new Vector2[capacity];
+    a.previousPositions = new Vector2[capacity];
+  }
+  if (mask & ComponentVelocity) a.velocities = new Vector2[capacity];
+  if (mask & ComponentSize) a.sizes = new Vector2[capacity];
+  if (mask & ComponentCollider) a.colliders = new CircleCollider[capacity];
+  if (mask & ComponentSprite) a.sprites = new SpriteId[capacity];
+  if (mask & ComponentLifetime) a.lifetimes = new float[capacity];
+  return &a;
+}
+
+Archetype* Registry::archetype(ComponentMask mask) {
+  for (unsigned i = 0; i < m_archetypeCount; ++i) {
+    if (m_archetypes[i].mask == mask) {
+      return &m_archetypes[i];
+    }
+  }
+  return nullptr;
+}
+
+Entity Registry::create(Archetype* archetype, unsigned* outRow) {
+  if (archetype == nullptr || archetype->count >= archetype->capacity ||
+      m_freeHead == s_noFreeSlot) {
+    return InvalidEntity;
+  }
+
+  const uint32_t index = m_freeHead;
+  EntitySlot& slot = m_slots[index];
+  m_freeHead = slot.nextFree;
+
+  const unsigned row = archetype->count++;
+  slot.archetype = (uint16_t)(archetype - m_archetypes);
+  slot.row = row;
+  slot.nextFree = s_noFreeSlot;
+
+  const Entity entity = {index, slot.generation};
+  archetype->entities[row] = entity;
+
+  if (outRow != nullptr) {
+    *outRow = row;
+  }
+  return entity;
+}
+
+void Registry::destroy(Entity entity) {
+  if (isAlive(entity) == false) {
+    return;
+  }
+  const EntitySlot& slot = m_slots[entity.index];
+  destroyRow(&m_archetypes[slot.archetype], slot.row);
+}
+
+void Registry::destroyRow(Archetype* a, unsigned row) {
+  if (a == nullptr || row >= a->count) {
+    return;
+  }
+
+  // 파괴된 엔티티 슬롯은 세대를 올려서 프리 리스트로 반환
+  const uint32_t index = a->entities[row].index;
+  EntitySlot& slot = m_slots[index];
+  ++slot.generation;
+  slot.nextFree = m_freeHead;
+  m_freeHead = index;
+
+  // 마지막 행을 빈 자리로 옮김 (swap-remove)
+  const unsigned last = --a->count;
+  if (row != last) {
+    a->entities[row] = a->entities[last];
+    if (a->positions) {
+      a->positions[row] = a->positions[last];
+      a->previousPositions[row] = a->previousPositions[last];
+    }
+    if (a->velocities) a->velocities[row] = a->velocities[last];
+    if (a->sizes) a->sizes[row] = a->sizes[last];
+    if (a->colliders) a->colliders[row] = a->colliders[last];
+    if (a->sprites) a->sprites[row] = a->sprites[last];
+    if (a->lifetimes) a->lifetimes[row] = a->lifetimes[last];
+    m_slots[a->entities[row].index].row = row;
+  }
+}
+
+bool Registry::isAlive(Entity entity) const {
+  return entity.index < m_slotCount &&
+         m_slots[entity.index].generation == entity.generation;
+}
+
+SpriteId Registry::addSprite(const TGA* tga) {
+  for (unsigned i = 0; i < m_spriteCount; ++i) {
+    if (m_sprites[i] == tga) {
+      return (SpriteId)i;
+    }
+  }
+  if (m_spriteCount >= s_maxSprites) {
+    std::cout << "Registry sprite table is full \n";
+    return 0;
+  }
+  m_sprites[m_spriteCount] = tga;
+  return (SpriteId)m_spriteCount++;
+}
+
+size_t Registry::snapshotCapacity() const {
+  size_t size = sizeof(m_freeHead) + sizeof(EntitySlot) * m_slotCount;
+  for (unsigned i = 0; i < m_archetypeCount; ++i) {
+    size += sizeof(unsigned) + rowSize(m_archetypes[i]) * m_archetypes[i].capacity;
+  }
+  return size;
+}
+
+void Registry::save(SnapshotWriter& writer) const {
+  writer.write(m_freeHead);
+  writer.writeArray(m_slots, m_slotCount);
+  for (unsigned i = 0; i < m_archetypeCount; ++i) {
+    const Archetype& a = m_archetypes[i];
+    const unsigned n = a.count;
+    writer.write(n);
+    writer.writeArray(a.entities, n);
+    if (a.positions) {
+      writer.writeArray(a.positions, n);
+      writer.writeArray(a.previousPositions, n);
+    }
+    if (a.velocities) writer.writeArray(a.velocities, n);
+    if (a.sizes) writer.writeArray(a.sizes, n);
+    if (a.colliders) writer.writeArray(a.colliders, n);
+    if (a.sprites) writer.writeArray(a.sprites, n);
+    if (a.lifetimes) writer.writeArray(a.lifetimes, n);
+  }
+}
+
+void Registry::restore(SnapshotReader& reader) {
+  reader.read(&m_freeHead);
+  reader.readArray(m_slots, m_slotCount);
+  for (unsigned i = 0; i < m_archetypeCount; ++i) {
+    Archetype& a = m_archetypes[i];
+    reader.read(&a.count);
+    const unsigned n = a.count;
+    reader.readArray(a.entities, n);
+    if (a.positions) {
+      reader.readArray(a.positions, n);
+      reader.readArray(a.previousPositions, n);
+    }
+    if (a.velocities) reader.readArray(a.velocities, n);
+    if (a.sizes) reader.readArray(a.sizes, n);
+    if (a.colliders) reader.readArray(a.colliders, n);
+    if (a.sprites) reader.readArray(a.sprites, n);
+    if (a.lifetimes) reader.readArray(a.lifetimes, n);
+  }
+}
+
+namespace {
+// 한 잡이 이동시키는 엔티티 수. 이보다 작은 아키타입은 나누지 않음
+constexpr unsigned s_motionGrain = 4096;
+
+/// [begin, end) 행만 이동
+void integrateRows(Archetype& a, unsigned begin, unsigned end, float delta) {
+  using namespace simd;
+
+  const float4 delta4 = set1(delta);
+  // Vector2 컬럼은 [x0, y0, x1, y1, ...] 형태의 연속된 float 배열
+  float* positions = &a.positions[0].x;
+  float* previous = &a.previousPositions[0].x;
+  const float* velocities = &a.velocities[0].x;
+  const unsigned n = end * 2;
+
+  // 엔티티 두 개(float 4개)씩 처리
+  unsigned i = begin * 2;
+  for (; i + s_width <= n; i += s_width) {
+    const float4 position = load(positions + i);
+    store(previous + i, position);
+    store(positions + i, madd(load(velocities + i), delta4, position));
+  }
+  for (; i < n; ++i) {
+    previous[i] = positions[i];
+    positions[i] += velocities[i] * delta;
+  }
+}
+}  // namespace
+
+void integrateMotion(Registry& registry, float delta, JobSystem* jobs) {
+  registry.forEach(ComponentPosition | ComponentVelocity, [&](Archetype& a) {
+    if (jobs == nullptr) {
+      integrateRows(a, 0, a.count, delta);
+      return;
+    }
+    jobs->parallelFor(0, a.count, s_motionGrain,
+                      [&](unsigned begin, unsigned end) {
+                        integrateRows(a, begin, end, delta);
+                      });
+  });
+}
+
+unsigned destroyBeyondY(Registry& registry, Archetype* archetype, float maxY) {
+  using namespace simd;
+
+  // 먼저 y만 비교해서 넘어간 엔티티가 있는지 확인. 대부분의 틱에서는 여기서 끝남
+  // [x0, y0, x1, y1] 순서이므로 x 레인은 무한대와 비교해서 항상 통과
+  const float infinity = std::numeric_limits<float>::infinity();
+  const float limits[4] = {infinity, maxY, infinity, maxY};
+  const float4 low = set1(-infinity);
+  const float4 high = load(limits);
+
+  const float* positions = &archetype->positions[0].x;
+  const unsigned n = archetype->count * 2;
+  bool anyBeyond = false;
+  unsigned i = 0;
+  for (; i + s_width <= n && anyBeyond == false; i += s_width) {
+    anyBeyond = anyOutside(load(positions + i), low, high);
+  }
+  for (; i < n && anyBeyond == false; i += 2) {
+    anyBeyond = positions[i + 1] > maxY;
+  }
+  if (anyBeyond == false) {
+    return 0;
+  }
+
+  // 넘어간 행만 제거. swap-remove 이므로 역순으로 순회
+  unsigned destroyed = 0;
+  for (unsigned row = archetype->count; row-- > 0;) {
+    if (archetype->positions[row].y > maxY) {
+      registry.destroyRow(archetype, row);
+      ++destroyed;
+    }
+  }
+  return destroyed;
+}
+
+}  // namespace shmup
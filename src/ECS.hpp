@@ -0,0 +1,178 @@
+//------------------------------------------------------------------------------
+// File: ECS.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CircleCollider.hpp"
+#include "Math.hpp"
+
+namespace shmup {
+
+class JobSystem;
+class TGA;
+class SnapshotReader;
+class SnapshotWriter;
+
+/// 컴포넌트 종류. 아키타입은 이 비트들의 조합(마스크)으로 구분된다.
+enum ComponentType : uint32_t {
+  ComponentNone = 0x0000,
+  ComponentPosition = 0x0001,
+  ComponentVelocity = 0x0002,
+  ComponentSize = 0x0004,
+  ComponentCollider = 0x0008,
+  ComponentSprite = 0x0010,
+  ComponentLifetime = 0x0020,
+};
+
+using ComponentMask = uint32_t;
+
+/// 스프라이트 컴포넌트는 포인터 대신 Registry 스프라이트 테이블의 인덱스를 저장
+using SpriteId = uint16_t;
+
+/// @brief 엔티티 핸들. 세대(generation)가 다르면 이미 파괴된 엔티티를 가리킨다.
+struct Entity {
+  uint32_t index;
+  uint32_t generation;
+};
+
+constexpr Entity InvalidEntity = { 0xFFFFFFFFu, 0 };
+
+/// @brief 같은 컴포넌트 조합을 가진 엔티티들의 저장소.
+/// 컴포넌트마다 연속된 배열(컬럼)을 가지며, 마스크에 없는 컬럼은 nullptr.
+/// 행(row)은 항상 [0, count) 구간에 빈틈없이 채워져 있다.
+struct Archetype {
+  ComponentMask mask = ComponentNone;
+
+  unsigned count = 0;
+
+  unsigned capacity = 0;
+
+  Entity* entities = nullptr;
+
+  Vector2* positions = nullptr;
+
+  /// 직전 시뮬레이션 틱의 위치. 위치 컴포넌트가 있으면 항상 함께 할당되며
+  /// 렌더링할 때 positions 와 보간하는 데 사용
+  Vector2* previousPositions = nullptr;
+
+  Vector2* velocities = nullptr;
+
+  Vector2* sizes = nullptr;
+
+  /// 충돌체의 position 은 엔티티 위치 기준의 오프셋.
+  /// 월드 좌표의 중심은 positions[row] + colliders[row].position
+  CircleCollider* colliders = nullptr;
+
+  SpriteId* sprites = nullptr;
+
+  float* lifetimes = nullptr;
+
+  bool has(ComponentMask required) const {
+    return (mask & required) == required;
+  }
+};
+
+/// @brief 아키타입 기반 엔티티 저장소
+class Registry {
+ public:
+  Registry();
+
+  ~Registry();
+
+  Registry(const Registry&) = delete;
+  Registry& operator=(const Registry&) = delete;
+
+  /// @brief 전체 엔티티 수의 상한을 정하고 엔티티 테이블을 미리 할당
+  bool init(unsigned maxEntities);
+
+  /// @brief 주어진 마스크의 아키타입을 용량만큼 미리 할당해서 생성.
+  /// 같은 마스크의 아키타입이 이미 있으면 그것을 반환.
+  Archetype* createArchetype(ComponentMask mask, unsigned capacity);
+
+  /// @brief 주어진 마스크의 아키타입 반환, 없으면 nullptr
+  Archetype* archetype(ComponentMask mask);
+
+  /// @brief 아키타입에 새 엔티티 추가. 가득 찼으면 InvalidEntity 반환.
+  /// 새 행의 컴포넌트 값은 호출한 쪽에서 채워야 함.
+  Entity create(Archetype* archetype, unsigned* outRow = nullptr);
+
+  /// @brief 엔티티 파괴. 마지막 행을 빈 자리로 옮겨 컬럼을 빽빽하게 유지.
+  void destroy(Entity entity);
+
+  /// @brief 아키타입의 행을 직접 파괴. 역순으로 순회하면서 호출하면 안전하다.
+  void destroyRow(Archetype* archetype, unsigned row);
+
+  bool isAlive(Entity entity) const;
+
+  /// @brief 요구하는 컴포넌트를 모두 가진 아키타입만 순회
+  template <typename Fn>
+  void forEach(ComponentMask required, Fn&& fn) {
+    for (unsigned i = 0; i < m_archetypeCount; ++i) {
+      Archetype& archetype = m_archetypes[i];
+      if (archetype.has(required) && archetype.count > 0) {
+        fn(archetype);
+      }
+    }
+  }
+
+  SpriteId addSprite(const TGA* tga);
+
+  const TGA* sprite(SpriteId id) const { return m_sprites[id]; }
+
+  /// @brief save() 가 쓰는 최대 바이트 수
+  size_t snapshotCapacity() const;
+
+  /// @brief 엔티티 테이블과 아키타입의 살아있는 행만 기록.
+  /// 아키타입 구성과 스프라이트 테이블은 초기화할 때 정해지므로 기록하지 않음
+  void save(SnapshotWriter& writer) const;
+
+  /// @brief 같은 구성으로 초기화된 레지스트리에서만 사용
+  void restore(SnapshotReader& reader);
+
+ public:
+  static constexpr unsigned s_maxArchetypes = 16;
+
+  static constexpr unsigned s_maxSprites = 16;
+
+ private:
+  struct EntitySlot {
+    uint32_t generation;
+    uint16_t archetype;
+    uint32_t row;
+    uint32_t nextFree;
+  };
+
+  Archetype m_archetypes[s_maxArchetypes];
+
+  unsigned m_archetypeCount = 0;
+
+  EntitySlot* m_slots = nullptr;
+
+  unsigned m_slotCount = 0;
+
+  uint32_t m_freeHead = 0xFFFFFFFFu;
+
+  const TGA* m_sprites[s_maxSprites] = {};
+
+  unsigned m_spriteCount = 0;
+};
+
+/// @brief 이동 시스템: 위치와 속도를 가진 모든 아키타입에 대해
+/// 현재 위치를 previousPositions 에 기록하고
+/// position += velocity * delta 를 컬럼 단위로 수행
+/// @brief 위치와 속도가 있는 모든 엔티티를 delta 만큼 이동.
+/// jobs 가 있으면 큰 아키타입은 행 구간을 나눠서 병렬로 처리
+void integrateMotion(Registry& registry, float delta, JobSystem* jobs = nullptr);
+
+/// @brief y 좌표가 maxY 를 넘어간 엔티티를 모두 파괴하고 그 개수를 반환.
+/// SIMD로 y만 비교해서 넘어간 엔티티가 없으면 바로 끝난다.
+unsigned destroyBeyondY(Registry& registry, Archetype* archetype, float maxY);
+
+}  // namespace shmup
@@ -7,177 +7,211 @@
 
 #include "EnemyManager.hpp"
 
-#include <SDL.h>
 #include <iostream>
 
 #include "Math.hpp"
+#include "Snapshot.hpp"
 
 namespace shmup {
 
 #if _WIN32
 constexpr auto s_enemyFilepath = "../resources/enemy.tga";
+constexpr auto s_patternBulletFilepath = "../resources/bullet.tga";
 #else
 constexpr auto s_enemyFilepath = "../../resources/enemy.tga";
+constexpr auto s_patternBulletFilepath = "../../resources/bullet.tga";
 #endif
 
-// 아래 값들은 게임 시작 데이터로 분류 가능
-float s_enemyMaxXPos = 0.0f;    // 최대 적 X 좌표
-float s_enemyMaxYPos = 0.0f;    // 최대 적 Y 좌표
-float s_enemySpeed = 0.1f;     // 밀리초당 이동 거리
-unsigned s_enemyMaxCount = 1000;  // 최대 적 개수 (30)
-double s_spawnDelay = 10.0f;  // 적 스폰 빈도 수 (밀리초)
+// 같은 시드에서도 다른 매니저와 겹치지 않는 난수 스트림 번호
+constexpr uint64_t s_enemyRandomStream = 2;
+
+// 탄막이 화면 밖으로 이만큼 나가면 제거
+constexpr float s_patternMargin = 32.0f;
+
+// 조준탄 부채꼴 전체 각도 (라디안)
+constexpr float s_aimedSpread = 0.6f;
+
+// 적이 가지는 컴포넌트. 충돌체 컴포넌트가 있어서 별 아키타입과 구분된다
+constexpr ComponentMask s_enemyComponents = ComponentPosition | ComponentVelocity |
+                                            ComponentSize | ComponentCollider |
+                                            ComponentSprite;
 
 EnemyManager::EnemyManager() {}
 
 EnemyManager::~EnemyManager() {
-  delete[] m_enemies;
-  m_enemies = nullptr;
+  delete m_texture;
+  delete m_bulletTexture;
 }
 
-bool EnemyManager::init(SDL_Renderer* renderer, int width, int height) {
+bool EnemyManager::init(Registry* registry, int width, int height,
+                        const GameConfig& config, uint64_t seed,
+                        double tick, JobSystem* jobs) {
+  m_config = &config;
+  m_random.seed(seed, s_enemyRandomStream);
+
   m_texture = new TGA();
   if (m_texture->readFromFile(s_enemyFilepath) == false) {
     std::cout << "EnemyManager read enemy TGA failed \n";
     return false;
   }
 
-  if (m_texture->createTexture(renderer) == false) {
-    std::cout << "EnemyManager create enemy texture failed \n";
-    return false;
-  }
+  m_size = {(float)m_texture->header()->width,
+            (float)m_texture->header()->height};
+  m_collider = {{m_size.x / 2, m_size.y / 2}, m_size.x / 2};
 
-  Enemy::setColliderRadius(m_texture->header()->width / 2);
+  m_maxXPos = width - m_texture->header()->width;
+  m_maxYPos = height + m_texture->header()->height; // 밑에 완전히 사라질 정도
 
-  s_enemyMaxXPos = width - m_texture->header()->width;
-  s_enemyMaxYPos = height + m_texture->header()->height; // 밑에 완전히 사라질 정도
+  // 적 아키타입 생성: 컬럼을 최대 적 개수만큼 미리 할당
+  m_registry = registry;
+  m_jobs = jobs;
+  m_enemies = m_registry->createArchetype(s_enemyComponents,
+                                          m_config->maxEnemyCount);
+  if (m_enemies == nullptr) {
+    std::cout << "EnemyManager create enemy archetype failed \n";
+    return false;
+  }
+  m_sprite = m_registry->addSprite(m_texture);
 
-  // 적 배열 처음 생성
-  m_enemies = new Enemy[s_enemyMaxCount];
-  if(m_enemies == nullptr) {
-    std::cout << "EnemyManager allocate pre enemy array failed \n";
+  // 탄막
+  m_bulletTexture = new TGA();
+  if (m_bulletTexture->readFromFile(s_patternBulletFilepath) == false) {
+    std::cout << "EnemyManager load pattern bullet texture failed \n";
     return false;
   }
-  m_enemyCount = s_enemyMaxCount;
-
-  // 한번 설정되고 변하지 않는 값만 여기서 설정
-  for (unsigned i = 0; i < m_enemyCount; ++i) {
-    Enemy* enemy = &m_enemies[i];
-    Vector2 value = {(float)m_texture->header()->width,
-                     (float)m_texture->header()->height};
-    enemy->size(value);
-    enemy->setCollider(0.0f, 0.0f, 0.0f);
+
+  if (m_patterns.init(m_config->maxPatternBulletCount, (float)tick,
+                      (float)width, (float)height, s_patternMargin) == false) {
+    std::cout << "EnemyManager init pattern engine failed \n";
+    return false;
   }
   return true;
 }
 
-void EnemyManager::setEnemyRandomPos(Enemy* enemy) {
-  if (m_texture == nullptr) {
-    return;
+/// @brief 적 생성
+bool EnemyManager::spawnEnemy() {
+  unsigned row = 0;
+  if (m_registry->create(m_enemies, &row).index == InvalidEntity.index) {
+    return false;
   }
 
-  // x: 0 ~ s_enemyMaxXPos 사이의 값으로 설정
-  Vector2 value = {(float)(rand() / ((RAND_MAX + 1u) /
-                                     s_enemyMaxXPos)),  
-                   0.0f};
-  enemy->position(value);
+  // x: 0 ~ m_maxXPos 사이의 값으로 설정
+  m_enemies->positions[row] = {m_random.range(0.0f, m_maxXPos), 0.0f};
+  m_enemies->previousPositions[row] = m_enemies->positions[row];
 
-  // 충돌체 위치 업데이트
-  Vector2 colliderPos = {
-      enemy->position().x + ((float)m_texture->header()->width / 2),
-      enemy->position().y + ((float)m_texture->header()->height / 2)};
-  enemy->setCollider(colliderPos.x, colliderPos.y, 0.0f);
+  // 적은 아래로만 이동
+  // m_enemies->velocities[row] = {0.0f, m_random.range(0.01f, 2.01f)};
+  m_enemies->velocities[row] = {0.0f, m_config->enemySpeed};
 
-  // 디버그 충돌체 정점 업데이트
-  enemy->moveDebugColliderPoints(colliderPos);
+  m_enemies->sizes[row] = m_size;
+  m_enemies->colliders[row] = m_collider;
+  m_enemies->sprites[row] = m_sprite;
+  return true;
 }
 
-/// @brief 적 생성
-void EnemyManager::spawnEnemy() {
-  if(m_enemies == nullptr) return;
-
-  // Idle 상태인 적 선택
-  Enemy* enemy = nullptr;
-  for(unsigned i = 0; i < m_enemyCount; ++i) {
-    if(m_enemies[i].state() == EnemyStateIdle) {
-      enemy = &m_enemies[i];
-      break;
-    }
+void EnemyManager::fireVolley(const Vector2& target) {
+  if (m_enemies == nullptr || m_enemies->count == 0) {
+    return;
   }
-  if (enemy == nullptr) return;
-
-  //std::cout << "EnemyManager::spawnEnemy called\n";
-
-  // 위치 변경
-  setEnemyRandomPos(enemy);
-
-  // 속도 업데이트
-  // enemy->speed((float)(0.01f + rand() / ((RAND_MAX + 1u) / 2)));
-  enemy->speed(s_enemySpeed);
-
-  // 적 상태 변경
-  enemy->state(EnemyStateMove);
 
-  // 최종 목적지 설정
-  enemy->destination({ enemy->position().x, s_enemyMaxYPos });
+  const unsigned row = m_random.below(m_enemies->count);
+  const Vector2 origin = m_enemies->positions[row] + m_enemies->colliders[row].position;
+
+  PatternDesc desc = {};
+  desc.type = (PatternType)(m_volleyCount++ % 3);
+  desc.count = m_config->volleyBulletCount;
+  desc.speed = m_config->patternBulletSpeed;
+  switch (desc.type) {
+  case PatternRadial: {
+    desc.startAngle = m_random.range(0.0f, 6.28318531f);
+    break;
+  }
+  case PatternSpiral: {
+    desc.startAngle = m_spiralAngle;
+    desc.angularVelocity = m_config->patternAngularVelocity;
+    m_spiralAngle += 0.2f;
+    break;
+  }
+  case PatternAimed: {
+    // 조준탄은 개수를 줄이는 대신 점점 빨라짐
+    desc.count = (desc.count + 3) / 4;
+    desc.spread = s_aimedSpread;
+    desc.acceleration = desc.speed * 0.001f;
+    break;
+  }
+  }
 
-  enemy->isVisible(true);
+  m_patterns.emit(desc, origin, target);
 }
 
-void EnemyManager::updateState(double delta) {
-  if(m_enemies == nullptr) {
+void EnemyManager::updateState(double delta, const Vector2& target) {
+  if (m_enemies == nullptr) {
     return;
   }
 
   m_lastTimeEnemySpawned += delta;
 
-  if(m_lastTimeEnemySpawned >= s_spawnDelay) {
-    // 새로운 적 스폰
-    spawnEnemy();
-    m_lastTimeEnemySpawned = 0.0f;
-  }
-
-  // 적 배열 돌면서 "움직임" 상태인 적 이동
-  for(unsigned i = 0; i < m_enemyCount; ++i) {
-    Enemy* enemy = &m_enemies[i];
-    switch (enemy->state()) {
-      case EnemyStateMove: {
-        Vector2 currentPos = enemy->position();
-        // Vector2 direction = (enemy->destination() - currentPos).normalized();
-        float magnitude = enemy->speed() * delta;
-        // Vector2 movement = direction * magnitude;
-
-        // 이동
-        enemy->position({ currentPos.x, currentPos.y + magnitude });
-
-        if ((enemy->destination() - enemy->position()).magnitude() < magnitude) {
-          // 초기 위치로
-          enemy->isVisible(false);
-          enemy->state(EnemyStateIdle);
-          setEnemyRandomPos(enemy);
-        } else {
-          // 충돌체 위치 업데이트
-          Vector2 colliderPos = {
-              enemy->position().x + ((float)m_texture->header()->width / 2),
-              enemy->position().y + ((float)m_texture->header()->height / 2)};
-          enemy->setCollider(colliderPos.x, colliderPos.y, 0.0f);
-
-          // DEBUG: 이 위치 이동은 Math::createCirclePoints 보다 빠를 것
-          for (unsigned i = 0; i < 180; ++i) {
-            enemy->debugColliderPoints()[i].y += magnitude;
-          }
-        }
-        break;
+  // 새로운 적 스폰. 기본은 한 틱에 최대 한 마리이고 남은 시간은 버림.
+  // enemy_spawn_catch_up 이면 스폰 간격이 틱보다 짧을 때 밀린 만큼 한 틱에 여러 마리를 스폰.
+  // 아키타입이나 레지스트리의 엔티티 슬롯이 가득 차면 밀린 스폰은 버림
+  const double spawnDelay = m_config->enemySpawnDelay;
+  while (m_lastTimeEnemySpawned >= spawnDelay) {
+    if (spawnEnemy() == false) {
+      if (m_reportedSpawnCap == false) {
+        std::cout << "EnemyManager spawn capped at " << m_enemies->count
+                  << " enemies (max_enemy_count " << m_enemies->capacity
+                  << ", max_entity_count " << m_config->maxEntityCount
+                  << ")\n";
+        m_reportedSpawnCap = true;
       }
-      case EnemyStateHit: {
-        // 맞은 것에 대한 처리
-        enemy->isVisible(false);
-        enemy->state(EnemyStateIdle);
-        setEnemyRandomPos(enemy);
-        break;
-      }
-      default: break;
+      m_lastTimeEnemySpawned = 0.0f;
+      break;
     }
+    if (m_config->enemySpawnCatchUp == 0) {
+      m_lastTimeEnemySpawned = 0.0f;
+      break;
+    }
+    m_lastTimeEnemySpawned -= spawnDelay;
   }
+
+  // 이동은 이동 시스템(integrateMotion)이 컬럼 단위로 처리하므로
+  // 여기서는 화면 아래로 완전히 사라진 적만 제거
+  destroyBeyondY(*m_registry, m_enemies, m_maxYPos);
+
+  // 탄막: 기존 탄을 한 틱 진행시킨 뒤 주기마다 새 볼리 발사
+  m_patterns.update(m_jobs);
+
+  m_lastVolleyTime += delta;
+  if (m_lastVolleyTime >= m_config->volleyDelay) {
+    fireVolley(target);
+    m_lastVolleyTime = 0.0;
+  }
+}
+
+const Archetype& EnemyManager::enemies() const { return *m_enemies; }
+
+size_t EnemyManager::snapshotCapacity() const {
+  return sizeof(m_random) + sizeof(m_lastTimeEnemySpawned) +
+         sizeof(m_lastVolleyTime) + sizeof(m_volleyCount) +
+         sizeof(m_spiralAngle) + m_patterns.snapshotCapacity();
+}
+
+void EnemyManager::save(SnapshotWriter& writer) const {
+  writer.write(m_random);
+  writer.write(m_lastTimeEnemySpawned);
+  writer.write(m_lastVolleyTime);
+  writer.write(m_volleyCount);
+  writer.write(m_spiralAngle);
+  m_patterns.save(writer);
+}
+
+void EnemyManager::restore(SnapshotReader& reader) {
+  reader.read(&m_random);
+  reader.read(&m_lastTimeEnemySpawned);
+  reader.read(&m_lastVolleyTime);
+  reader.read(&m_volleyCount);
+  reader.read(&m_spiralAngle);
+  m_patterns.restore(reader);
 }
 
 }  // namespace shmup
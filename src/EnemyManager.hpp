@@ -7,9 +7,11 @@
 
 #pragma once
 
-#include "GameObject.hpp"
+#include "BulletPattern.hpp"
+#include "ECS.hpp"
+#include "GameConfig.hpp"
+#include "Random.hpp"
 #include "TGA.hpp"
-#include "Enemy.hpp"
 
 namespace shmup {
 
@@ -19,36 +21,93 @@ public:
 
   ~EnemyManager();
 
-  bool init(SDL_Renderer* renderer, int width, int height);
+  /// @brief seed 는 적 전용 난수 스트림의 시드. config 는 매니저보다 오래 살아야 함
+  /// tick 은 updateState 를 호출하는 고정 틱 길이(ms)로, 탄막 회전 상수 계산에 사용
+  /// jobs 가 있으면 탄막 갱신을 병렬로 처리
+  bool init(Registry* registry, int width, int height,
+            const GameConfig& config, uint64_t seed, double tick,
+            JobSystem* jobs = nullptr);
 
-  void spawnEnemy();
+  /// @brief 적 하나 생성
+  /// @return 아키타입이나 레지스트리의 엔티티 슬롯이 가득 차면 false
+  bool spawnEnemy();
 
-  void updateState(double delta);
+  /// @brief 적 스폰/제거와 탄막 발사/갱신. 조준탄은 target 을 향함
+  /// 적 이동은 integrateMotion 이 처리하므로 그 이후에 호출
+  void updateState(double delta, const Vector2& target);
 
-  Enemy* enemies() {
-    return m_enemies;
+  /// @brief 화면에 나와 있는 적만 [0, count) 구간에 빽빽하게 담긴 아키타입
+  const Archetype& enemies() const;
+
+  const TGA& enemyTexture() {
+    return *m_texture;
   }
 
-  unsigned enemyCount() const {
-    return m_enemyCount;
+  /// @brief 적이 쏜 탄막
+  PatternEngine& patterns() {
+    return m_patterns;
   }
 
-  const TGA& enemyTexture() {
-    return *m_texture;
+  const PatternEngine& patterns() const {
+    return m_patterns;
+  }
+
+  const TGA& patternBulletTexture() const {
+    return *m_bulletTexture;
   }
 
+  /// @brief 난수 상태, 스폰/볼리 타이머와 탄막을 기록. 적 자체는 레지스트리가 기록함
+  size_t snapshotCapacity() const;
+
+  void save(SnapshotWriter& writer) const;
+
+  void restore(SnapshotReader& reader);
+
 private:
-  void setEnemyRandomPos(Enemy* enemy);
+  /// @brief 살아있는 적 하나를 골라서 다음 패턴을 발사
+  void fireVolley(const Vector2& target);
 
 private:
+  const GameConfig* m_config = nullptr;
+
   TGA* m_texture = nullptr;
 
-  Enemy* m_enemies = nullptr;
+  Registry* m_registry = nullptr;
+
+  JobSystem* m_jobs = nullptr;
+
+  Archetype* m_enemies = nullptr;
 
-  unsigned m_enemyCount = 0;
+  SpriteId m_sprite = 0;
+
+  // 모든 적이 공유하는 크기와 충돌체 (충돌체 위치는 적 위치 기준 오프셋)
+  Vector2 m_size;
+
+  CircleCollider m_collider = {};
+
+  // 화면 크기로 정해지는 값. 튜닝 값은 GameConfig 에 있음
+  float m_maxXPos = 0.0f;    // 최대 적 X 좌표
+
+  float m_maxYPos = 0.0f;    // 최대 적 Y 좌표 (밑으로 완전히 사라지는 위치)
+
+  Random m_random;
 
   double m_lastTimeEnemySpawned = 0.0f;
+
+  // 스폰 상한에 걸렸다는 경고를 한번만 출력하기 위한 플래그 (게임 상태가 아니므로 스냅샷에서 제외)
+  bool m_reportedSpawnCap = false;
+
+  TGA* m_bulletTexture = nullptr;
+
+  PatternEngine m_patterns;
+
+  double m_lastVolleyTime = 0.0;
+
+  // 다음에 쏠 패턴 (PatternType 순서대로 돌아가며 사용)
+  unsigned m_volleyCount = 0;
+
+  // 스파이럴 시작 각도. 볼리마다 조금씩 돌려서 나선이 이어지게 함
+  float m_spiralAngle = 0.0f;
 };
 
 }  // namespace shmup
-
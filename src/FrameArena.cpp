@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+// File: FrameArena.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "FrameArena.hpp"
+
+#include <cassert>
+#include <iostream>
+
+namespace shmup {
+
+FrameArena::FrameArena() {}
+
+FrameArena::~FrameArena() { delete[] m_buffer; }
+
+bool FrameArena::init(size_t capacity) {
+  m_buffer = new uint8_t[capacity];
+  if (m_buffer == nullptr) {
+    std::cout << "FrameArena allocate buffer failed \n";
+    return false;
+  }
+  m_capacity = capacity;
+  m_offset.store(0);
+  return true;
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment) {
+  assert(alignment <= s_maxAlignment && (alignment & (alignment - 1)) == 0);
+
+  // 현재 위치를 정렬 단위로 올려서 잘라 냄. 다른 워커가 먼저 가져갔으면 다시 시도
+  const uintptr_t base = (uintptr_t)m_buffer;
+  size_t offset = m_offset.load(std::memory_order_relaxed);
+  uintptr_t aligned = 0;
+  size_t newOffset = 0;
+  do {
+    aligned = (base + offset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    newOffset = (size_t)(aligned - base) + size;
+
+    if (newOffset > m_capacity) {
+      // 용량 부족: 게임이 멈추지 않도록 힙에서 받고 횟수를 기록.
+      // 해제할 때 정렬 값을 모르므로 항상 최대 정렬로 받음
+      m_overflowCount.fetch_add(1, std::memory_order_relaxed);
+      return ::operator new(size, std::align_val_t(s_maxAlignment));
+    }
+  } while (m_offset.compare_exchange_weak(offset, newOffset,
+                                          std::memory_order_relaxed) == false);
+
+  return (void*)aligned;
+}
+
+void FrameArena::deallocate(void* ptr) {
+  if (ptr != nullptr && owns(ptr) == false) {
+    ::operator delete(ptr, std::align_val_t(s_maxAlignment));
+  }
+}
+
+void FrameArena::reset() {
+  const size_t offset = m_offset.exchange(0, std::memory_order_relaxed);
+  if (offset > m_highWaterMark) {
+    m_highWaterMark = offset;
+  }
+}
+
+bool FrameArena::owns(const void* ptr) const {
+  const uint8_t* p = (const uint8_t*)ptr;
+  return p >= m_buffer && p < m_buffer + m_capacity;
+}
+
+size_t FrameArena::highWaterMark() const {
+  const size_t offset = m_offset.load(std::memory_order_relaxed);
+  return (offset > m_highWaterMark) ? offset : m_highWaterMark;
+}
+
+}  // namespace shmup
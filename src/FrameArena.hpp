@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+// File: FrameArena.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace shmup {
+
+/// @brief 한 프레임 동안만 쓰는 임시 메모리를 위한 선형(bump) 할당기.
+/// 메인 루프가 매 반복 시작 시 reset() 하면 그 프레임의 할당이 한번에 해제된다.
+/// 개별 해제는 하지 않으며, 용량을 넘는 요청은 전역 힙으로 넘기고 따로 집계한다.
+/// allocate 는 여러 워커가 동시에 불러도 되지만 reset 은 할당하는 잡이 없을 때만 호출.
+class FrameArena {
+ public:
+  FrameArena();
+
+  ~FrameArena();
+
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+
+  bool init(size_t capacity);
+
+  /// @brief 지원하는 최대 정렬 (캐시 라인). 용량을 넘어 힙에서 받을 때도 이 단위로 정렬
+  static constexpr size_t s_maxAlignment = 64;
+
+  /// @brief 정렬을 맞춰서 size 바이트를 잘라 줌. 용량이 부족하면 전역 힙 사용.
+  /// alignment 는 2의 거듭제곱이고 s_maxAlignment 이하
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  /// @brief 아레나 메모리가 아니면(용량 초과로 힙에서 받은 경우) 해제
+  void deallocate(void* ptr);
+
+  template <typename T>
+  T* allocateArray(size_t count) {
+    return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+  }
+
+  /// @brief 이번 프레임의 사용량을 최고 사용량에 반영하고 처음부터 다시 사용
+  void reset();
+
+  bool owns(const void* ptr) const;
+
+  size_t capacity() const { return m_capacity; }
+
+  size_t used() const { return m_offset.load(std::memory_order_relaxed); }
+
+  /// @brief 지금까지 한 프레임에서 가장 많이 사용한 바이트 수
+  size_t highWaterMark() const;
+
+  /// @brief 용량 부족으로 전역 힙에 넘긴 할당 횟수 (0이어야 정상)
+  unsigned overflowCount() const { return m_overflowCount.load(); }
+
+ private:
+  uint8_t* m_buffer = nullptr;
+
+  size_t m_capacity = 0;
+
+  std::atomic<size_t> m_offset{0};
+
+  size_t m_highWaterMark = 0;
+
+  std::atomic<unsigned> m_overflowCount{0};
+};
+
+/// @brief STL 컨테이너가 FrameArena에서 메모리를 받도록 하는 어댑터.
+/// 예: std::vector<Contact, ArenaAllocator<Contact>> contacts(ArenaAllocator<Contact>(arena));
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(FrameArena& arena) : m_arena(&arena) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : m_arena(other.arena()) {}
+
+  T* allocate(size_t count) { return m_arena->allocateArray<T>(count); }
+
+  void deallocate(T* ptr, size_t) { m_arena->deallocate(ptr); }
+
+  FrameArena* arena() const { return m_arena; }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return m_arena == other.arena();
+  }
+
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return m_arena != other.arena();
+  }
+
+ private:
+  FrameArena* m_arena;
+};
+
+}  // namespace shmup
@@ -0,0 +1,74 @@
+//------------------------------------------------------------------------------
+// File: FrameCapture.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "FrameCapture.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include "TGA.hpp"
+
+namespace shmup {
+
+FrameCapture::FrameCapture() {}
+
+FrameCapture::~FrameCapture() { delete[] m_ticks; }
+
+bool FrameCapture::init(const char* directory, const char* ticks) {
+  // 쉼표 개수로 최대 틱 수를 정함
+  unsigned capacity = 1;
+  for (const char* c = ticks; *c != '\0'; ++c) {
+    capacity += *c == ',';
+  }
+  delete[] m_ticks;
+  m_ticks = new uint32_t[capacity];
+  m_count = 0, m_next = 0, m_missed = 0;
+  m_failed = false;
+
+  const char* c = ticks;
+  while (*c != '\0') {
+    char* end = nullptr;
+    const unsigned long tick = strtoul(c, &end, 10);
+    if (end == c || (*end != ',' && *end != '\0')) {
+      std::cout << "FrameCapture invalid tick list: " << ticks << "\n";
+      return false;
+    }
+    m_ticks[m_count++] = (uint32_t)tick;
+    c = *end == ',' ? end + 1 : end;
+  }
+  if (m_count == 0) {
+    std::cout << "FrameCapture needs at least one tick\n";
+    return false;
+  }
+
+  std::sort(m_ticks, m_ticks + m_count);
+  m_directory = directory;
+  return true;
+}
+
+void FrameCapture::capture(uint32_t tick, const Renderer& renderer) {
+  for (; done() == false && m_ticks[m_next] <= tick; ++m_next) {
+    if (m_ticks[m_next] != tick) {
+      std::cout << "FrameCapture missed tick " << m_ticks[m_next]
+                << " (frame drawn at tick " << tick << ")\n";
+      ++m_missed;
+      continue;
+    }
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/tick_%06u.tga", m_directory,
+             m_ticks[m_next]);
+    if (TGA::writeToFile(path, renderer.screenBuffer(), renderer.width(),
+                         renderer.height(), true) == false) {
+      m_failed = true;
+      return;
+    }
+  }
+}
+
+}  // namespace shmup
@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+// File: FrameCapture.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "Renderer.hpp"
+
+namespace shmup {
+
+/// @brief 정해진 틱에 합성한 화면 버퍼를 RLE TGA 파일(tick_000300.tga)로 저장.
+///
+/// 입력 재생처럼 결정적인 실행에서 찍은 프레임을 골든 프레임과 비교해서
+/// 렌더링 경로를 바꿔도 픽셀이 그대로인지 확인하는 데 사용한다.
+/// 한 프레임에 고정 스텝을 여러 번 돌아서 캡처 틱을 건너뛰면 다른 틱의 화면을
+/// 그 틱 이름으로 저장하지 않고 놓친 것으로 보고함.
+class FrameCapture {
+ public:
+  FrameCapture();
+
+  ~FrameCapture();
+
+  FrameCapture(const FrameCapture&) = delete;
+  FrameCapture& operator=(const FrameCapture&) = delete;
+
+  /// @brief ticks 는 쉼표로 구분한 틱 번호 목록 (예: "60,300,900")
+  bool init(const char* directory, const char* ticks);
+
+  /// @brief 지금까지 진행한 틱 수가 다음 캡처 틱과 같으면 화면 버퍼를 저장.
+  /// 이미 지나친 캡처 틱은 놓친 것으로 세고 넘어감.
+  /// 파일 쓰기에 실패하면 그 뒤로는 캡처하지 않음
+  void capture(uint32_t tick, const Renderer& renderer);
+
+  /// @brief 모든 틱을 캡처했거나 실패해서 더 캡처할 것이 없으면 true
+  bool done() const { return m_failed || m_next == m_count; }
+
+  /// @brief 파일 쓰기에 실패했으면 true
+  bool failed() const { return m_failed; }
+
+  /// @brief 프레임이 건너뛰어서 캡처하지 못한 틱 수
+  unsigned missed() const { return m_missed; }
+
+  unsigned count() const { return m_count; }
+
+ private:
+  const char* m_directory = nullptr;
+
+  uint32_t* m_ticks = nullptr;
+
+  unsigned m_count = 0;
+
+  unsigned m_next = 0;
+
+  unsigned m_missed = 0;
+
+  bool m_failed = false;
+};
+
+}  // namespace shmup
@@ -0,0 +1,118 @@
+//------------------------------------------------------------------------------
+// File: FramePacer.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "FramePacer.hpp"
+
+#include <SDL.h>
+
+#include <iostream>
+
+#if defined(_WIN32)
+// Windows는 SDL_Delay(ms)로 슬립
+#elif defined(__APPLE__)
+#include <time.h>  // nanosleep; macOS에는 clock_nanosleep이 없음
+#else
+#include <time.h>  // clock_nanosleep
+#endif
+
+namespace shmup {
+
+namespace {
+// 마감 시각 이만큼 전부터는 슬립하지 않고 스핀. 슬립이 늦게 깨어나는 오차를 흡수
+#if defined(_WIN32)
+constexpr int64_t s_spinThresholdUs = 2000;  // 타이머 해상도가 1ms 수준
+#else
+constexpr int64_t s_spinThresholdUs = 500;
+#endif
+
+// 기다리는 동안 poll 을 호출하는 간격
+constexpr int64_t s_pollIntervalUs = 1000;
+}  // namespace
+
+FramePacer::FramePacer() {}
+
+void FramePacer::init(double targetFps) {
+  m_targetFps = targetFps;
+  m_frequency = SDL_GetPerformanceFrequency();
+  m_period = (targetFps > 0.0) ? (uint64_t)(m_frequency / targetFps) : 0;
+  m_deadline = SDL_GetPerformanceCounter() + m_period;
+}
+
+void FramePacer::wait(void (*poll)()) {
+  if (m_period == 0) {
+    return;
+  }
+
+  uint64_t now = SDL_GetPerformanceCounter();
+  if (now >= m_deadline) {
+    // 이미 늦었음: 밀린 프레임을 몰아서 보내지 않도록 마감 시각을 지금부터 다시 잡음
+    ++m_missedFrames;
+    m_deadline = now + m_period;
+    return;
+  }
+
+  // 대부분은 슬립으로 기다림. poll 이 있으면 잘게 나눠 자면서 사이사이에 호출
+  int64_t remainingUs = (int64_t)((m_deadline - now) * 1000000 / m_frequency);
+  while (remainingUs > s_spinThresholdUs) {
+    if (poll == nullptr) {
+      sleepFor(remainingUs - s_spinThresholdUs);
+      break;
+    }
+    const int64_t sliceUs = remainingUs - s_spinThresholdUs;
+    sleepFor(sliceUs < s_pollIntervalUs ? sliceUs : s_pollIntervalUs);
+    poll();
+    now = SDL_GetPerformanceCounter();
+    remainingUs = (now < m_deadline)
+                      ? (int64_t)((m_deadline - now) * 1000000 / m_frequency)
+                      : 0;
+  }
+
+  // 남은 짧은 구간은 스핀
+  do {
+    now = SDL_GetPerformanceCounter();
+  } while (now < m_deadline);
+
+  const double errorUs = (double)(now - m_deadline) * 1000000.0 / m_frequency;
+  m_totalErrorUs += errorUs;
+  if (errorUs > m_maxErrorUs) {
+    m_maxErrorUs = errorUs;
+  }
+  ++m_pacedFrames;
+
+  m_deadline += m_period;
+}
+
+double FramePacer::averageErrorUs() const {
+  return (m_pacedFrames > 0) ? m_totalErrorUs / m_pacedFrames : 0.0;
+}
+
+void FramePacer::report() const {
+  if (m_period == 0) {
+    std::cout << "FramePacer: unlimited\n";
+    return;
+  }
+  std::cout << "FramePacer: target " << m_targetFps << " fps, paced "
+            << m_pacedFrames << ", missed " << m_missedFrames
+            << ", error avg " << averageErrorUs() << " us, max "
+            << m_maxErrorUs << " us\n";
+}
+
+void FramePacer::sleepFor(int64_t microseconds) {
+#if defined(_WIN32)
+  SDL_Delay((Uint32)(microseconds / 1000));
+#elif defined(__APPLE__)
+  timespec ts = { (time_t)(microseconds / 1000000),
+                  (long)(microseconds % 1000000) * 1000 };
+  nanosleep(&ts, nullptr);
+#else
+  timespec ts = { (time_t)(microseconds / 1000000),
+                  (long)(microseconds % 1000000) * 1000 };
+  clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, nullptr);
+#endif
+}
+
+}  // namespace shmup
@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// File: FramePacer.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace shmup {
+
+/// @brief 목표 프레임 레이트에 맞춰 메인 루프를 쉬게 하는 페이서.
+/// 마감 시각 직전까지는 OS 슬립으로 CPU를 놓아주고,
+/// 슬립 오차를 메우기 위해 마지막 짧은 구간만 스핀하며 기다린다.
+class FramePacer {
+ public:
+  FramePacer();
+
+  /// @brief 목표 프레임 레이트 설정. 0 이하이면 제한 없음
+  void init(double targetFps);
+
+  /// @brief present() 이후 호출. 다음 프레임의 마감 시각까지 대기.
+  /// poll 이 있으면 슬립하는 동안 약 1ms 마다 호출 (입력 펌프 등)
+  void wait(void (*poll)() = nullptr);
+
+  double targetFps() const { return m_targetFps; }
+
+  /// @brief 마감 시각 대비 실제로 깨어난 시각의 평균 오차(µs)
+  double averageErrorUs() const;
+
+  /// @brief 지금까지 가장 크게 늦게 깨어난 오차(µs)
+  double maxErrorUs() const { return m_maxErrorUs; }
+
+  /// @brief 프레임 처리에 시간을 다 써서 기다리지 못한 프레임 수
+  unsigned missedFrames() const { return m_missedFrames; }
+
+  void report() const;
+
+ private:
+  /// @brief 주어진 시간(µs) 동안 OS 슬립
+  static void sleepFor(int64_t microseconds);
+
+  double m_targetFps = 0.0;
+
+  uint64_t m_frequency = 0;
+
+  // 프레임 한번의 길이 (퍼포먼스 카운터 단위)
+  uint64_t m_period = 0;
+
+  uint64_t m_deadline = 0;
+
+  double m_totalErrorUs = 0.0;
+
+  double m_maxErrorUs = 0.0;
+
+  unsigned m_pacedFrames = 0;
+
+  unsigned m_missedFrames = 0;
+};
+
+}  // namespace shmup
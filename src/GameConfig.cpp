@@ -0,0 +1,161 @@
+//------------------------------------------------------------------------------
+// File: GameConfig.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "GameConfig.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace shmup {
+
+namespace {
+enum ConfigValueType {
+  ConfigValueUnsigned,
+  ConfigValueFloat,
+  ConfigValueDelay,  // 0 보다 큰 float (0 이면 한 틱에 스폰이 끝나지 않음)
+};
+
+/// 설정 키와 GameConfig 멤버의 대응표
+struct ConfigKey {
+  const char* name;
+  ConfigValueType type;
+  size_t offset;
+};
+
+const ConfigKey s_configKeys[] = {
+    {"max_entity_count", ConfigValueUnsigned, offsetof(GameConfig, maxEntityCount)},
+    {"frame_arena_size", ConfigValueUnsigned, offsetof(GameConfig, frameArenaSize)},
+    {"player_speed", ConfigValueFloat, offsetof(GameConfig, playerSpeed)},
+    {"player_fire_delay", ConfigValueDelay, offsetof(GameConfig, playerFireDelay)},
+    {"max_bullet_count", ConfigValueUnsigned, offsetof(GameConfig, maxBulletCount)},
+    {"bullet_speed", ConfigValueFloat, offsetof(GameConfig, bulletSpeed)},
+    {"enemy_speed", ConfigValueFloat, offsetof(GameConfig, enemySpeed)},
+    {"max_enemy_count", ConfigValueUnsigned, offsetof(GameConfig, maxEnemyCount)},
+    {"enemy_spawn_delay", ConfigValueDelay, offsetof(GameConfig, enemySpawnDelay)},
+    {"enemy_spawn_catch_up", ConfigValueUnsigned, offsetof(GameConfig, enemySpawnCatchUp)},
+    {"max_pattern_bullet_count", ConfigValueUnsigned, offsetof(GameConfig, maxPatternBulletCount)},
+    {"volley_delay", ConfigValueDelay, offsetof(GameConfig, volleyDelay)},
+    {"volley_bullet_count", ConfigValueUnsigned, offsetof(GameConfig, volleyBulletCount)},
+    {"pattern_bullet_speed", ConfigValueFloat, offsetof(GameConfig, patternBulletSpeed)},
+    {"pattern_angular_velocity", ConfigValueFloat, offsetof(GameConfig, patternAngularVelocity)},
+    {"max_star_count", ConfigValueUnsigned, offsetof(GameConfig, maxStarCount)},
+    {"star_spawn_delay", ConfigValueDelay, offsetof(GameConfig, starSpawnDelay)},
+    {"procedural_star_count", ConfigValueUnsigned, offsetof(GameConfig, proceduralStarCount)},
+};
+
+/// 앞뒤 공백 제거. 문자열 안에서 잘라내므로 복사하지 않음
+char* trim(char* text) {
+  while (*text == ' ' || *text == '\t') {
+    ++text;
+  }
+  char* end = text + strlen(text);
+  while (end > text && (end[-1] == ' ' || end[-1] == '\t' ||
+                        end[-1] == '\r' || end[-1] == '\n')) {
+    --end;
+  }
+  *end = '\0';
+  return text;
+}
+
+bool applyValue(GameConfig* config, const ConfigKey& key, const char* value) {
+  char* end = nullptr;
+  char* field = (char*)config + key.offset;
+  if (key.type == ConfigValueUnsigned) {
+    // strtoul 은 "-1" 을 ULONG_MAX 로 바꿔 주므로 부호를 직접 거름
+    if (*value == '-') {
+      return false;
+    }
+    errno = 0;
+    const unsigned long parsed = strtoul(value, &end, 10);
+    if (end == value || *end != '\0' || errno == ERANGE ||
+        parsed > UINT_MAX) {
+      return false;
+    }
+    *(unsigned*)field = (unsigned)parsed;
+  } else {
+    const float parsed = strtof(value, &end);
+    if (end == value || *end != '\0') {
+      return false;
+    }
+    // NaN 도 걸러지도록 부정형으로 비교
+    if (key.type == ConfigValueDelay && !(parsed > 0.0f)) {
+      return false;
+    }
+    *(float*)field = parsed;
+  }
+  return true;
+}
+}  // namespace
+
+bool loadGameConfig(const char* path, GameConfig* config) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+
+  char line[256];
+  unsigned lineNumber = 0;
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    ++lineNumber;
+
+    // 주석 제거
+    char* comment = strchr(line, '#');
+    if (comment != nullptr) {
+      *comment = '\0';
+    }
+
+    char* text = trim(line);
+    if (*text == '\0') {
+      continue;
+    }
+
+    char* separator = strchr(text, '=');
+    if (separator == nullptr) {
+      std::cout << path << ":" << lineNumber << ": expected key = value\n";
+      continue;
+    }
+    *separator = '\0';
+    const char* name = trim(text);
+    const char* value = trim(separator + 1);
+
+    bool known = false;
+    for (const ConfigKey& key : s_configKeys) {
+      if (strcmp(key.name, name) == 0) {
+        known = true;
+        if (applyValue(config, key, value) == false) {
+          std::cout << path << ":" << lineNumber << ": invalid value for "
+                    << name << "\n";
+        }
+        break;
+      }
+    }
+    if (known == false) {
+      std::cout << path << ":" << lineNumber << ": unknown key " << name << "\n";
+    }
+  }
+
+  fclose(file);
+
+  // 적과 별은 같은 레지스트리에서 엔티티를 받으므로 두 용량의 합만큼은 있어야 함
+  const unsigned long long required =
+      (unsigned long long)config->maxEnemyCount + config->maxStarCount;
+  if (config->maxEntityCount < required) {
+    std::cout << path << ": max_entity_count " << config->maxEntityCount
+              << " is less than max_enemy_count + max_star_count ("
+              << required << "), using " << required << "\n";
+    config->maxEntityCount =
+        (required > UINT_MAX) ? UINT_MAX : (unsigned)required;
+  }
+  return true;
+}
+
+}  // namespace shmup
@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// File: GameConfig.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+namespace shmup {
+
+/// @brief 게임 튜닝 값과 풀 용량. 시작할 때 한번 읽고 이후에는 const 로만 전달.
+/// 멤버의 기본값은 설정 파일이 없거나 키가 빠졌을 때 사용된다.
+struct GameConfig {
+  // 월드
+  unsigned maxEntityCount = 4096;      // 레지스트리가 관리하는 전체 엔티티 수의 상한
+  unsigned frameArenaSize = 1048576;   // 프레임마다 재사용하는 임시 메모리 크기 (바이트)
+
+  // 플레이어
+  float playerSpeed = 0.5f;            // 밀리초당 이동 거리
+  float playerFireDelay = 10.0f;       // 발사 간격 (밀리초)
+  unsigned maxBulletCount = 1000;      // 총알 풀 용량
+  float bulletSpeed = 0.7f;            // 밀리초당 이동 거리
+
+  // 적
+  float enemySpeed = 0.1f;             // 밀리초당 이동 거리
+  unsigned maxEnemyCount = 1000;       // 적 풀 용량
+  float enemySpawnDelay = 10.0f;       // 적 스폰 간격 (밀리초)
+  unsigned enemySpawnCatchUp = 0;      // 0 보다 크면 간격이 틱보다 짧을 때 밀린 스폰을 한 틱에 모두 처리
+
+  // 적 탄막
+  unsigned maxPatternBulletCount = 20000;  // 탄막 용량
+  float volleyDelay = 250.0f;              // 볼리 발사 간격 (밀리초)
+  unsigned volleyBulletCount = 24;         // 볼리 하나의 탄 개수
+  float patternBulletSpeed = 0.15f;        // 밀리초당 이동 거리
+  float patternAngularVelocity = 0.0015f;  // 스파이럴 회전 속도 (라디안/밀리초)
+
+  // 별
+  unsigned maxStarCount = 100;         // 별 아키타입 용량
+  float starSpawnDelay = 10.0f;        // 별 스폰 간격 (밀리초)
+  unsigned proceduralStarCount = 0;    // 0 보다 크면 스프라이트 별 대신 점 별 배경(StarField) 사용
+};
+
+/// @brief "키 = 값" 형식의 설정 파일을 읽어서 config 에 덮어씀.
+/// '#' 뒤는 주석이며, 모르는 키나 잘못된 값(음수 개수, 0 이하의 지연 등)은 경고만 출력하고 건너뜀.
+/// max_entity_count 가 max_enemy_count + max_star_count 보다 작으면 경고하고 그 합으로 올림.
+/// @return 파일을 열 수 없으면 false (config 는 그대로 유지)
+bool loadGameConfig(const char* path, GameConfig* config);
+
+}  // namespace shmup
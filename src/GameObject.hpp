@@ -7,9 +7,6 @@
 
 #pragma once
 
-#include <SDL.h>
-
-#include <memory>
 #include "CircleCollider.hpp"
 
 namespace shmup {
@@ -21,26 +18,24 @@ enum GameObjectTag : int {
   GameObjectTagBullet = 0x0100,
 };
 
+/// 게임 오브젝트는 힙 메모리를 가지지 않고 가상 함수도 없으므로
+/// memcpy로 복사하거나 옮길 수 있다 (trivially copyable).
+/// 풀이 오브젝트를 재배치해도 추가 비용이 없음.
 class GameObject {
  protected:
   GameObject();
 
-  ~GameObject();
+  ~GameObject() = default;
 
  public:
-  GameObject(const GameObject& rhs);
-  GameObject& operator=(const GameObject& rhs);
-
-  GameObject(GameObject&& rhs);
-  GameObject& operator=(GameObject&& rhs);
-  
-  virtual void setCollider(float x, float y, float radius);
+  void setCollider(float x, float y, float radius);
 
   bool hasCollider() const;
 
-  const CircleCollider* collider() { return m_collider; }
-
-  Vector2 getColliderCenterPosition() const;
+  /// @brief 콜라이더가 설정되지 않았으면 nullptr
+  const CircleCollider* collider() const {
+    return m_hasCollider ? &m_collider : nullptr;
+  }
 
   void tag(GameObjectTag tag) { m_tag = tag; }
   
@@ -50,6 +45,15 @@ class GameObject {
 
   void position(Vector2 pos);
 
+  /// @brief 직전 시뮬레이션 틱의 위치
+  Vector2 previousPosition() const { return m_previousPosition; }
+
+  /// @brief 현재 위치를 직전 틱 위치로 기록. 틱을 시작할 때와 스폰 직후 호출
+  void storePreviousPosition() { m_previousPosition = m_position; }
+
+  /// @brief 직전 틱과 현재 틱 위치 사이를 alpha(0 ~ 1)로 보간한 렌더링 위치
+  Vector2 interpolatedPosition(float alpha) const;
+
   Vector2 size() const { return m_size; }
 
   void size(Vector2 size) { m_size = size; }
@@ -58,20 +62,19 @@ class GameObject {
 
   void isVisible(bool value) { m_isVisible = value; }
 
-  virtual void onCollided(const GameObject& target) = 0;
-
-  /// @brief 계산을 통해 두 오브젝트가 충돌했는지 확인
-  static bool isCollided(const GameObject& a, const GameObject& b);
-
  protected:
   Vector2 m_position = { 0.0f, 0.0f };
 
+  Vector2 m_previousPosition = { 0.0f, 0.0f };
+
   Vector2 m_size = { 0.0f, 0.0f };
 
   GameObjectTag m_tag = GameObjectTagNone;
 
   bool m_isVisible = false;
 
-  CircleCollider* m_collider = nullptr;
+  bool m_hasCollider = false;
+
+  CircleCollider m_collider = {};
 };
 }  // namespace shmup
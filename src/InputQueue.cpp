@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// File: InputQueue.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "InputQueue.hpp"
+
+#include <iostream>
+
+namespace shmup {
+
+InputQueue::InputQueue() {}
+
+InputQueue::~InputQueue() { delete[] m_events; }
+
+bool InputQueue::init(unsigned capacity, uint64_t frequency) {
+  unsigned size = 1;
+  while (size < capacity) {
+    size <<= 1;
+  }
+  m_events = new TimedInputEvent[size];
+  if (m_events == nullptr) {
+    std::cout << "InputQueue allocate events failed \n";
+    return false;
+  }
+  m_mask = size - 1;
+  m_frequency = frequency ? frequency : 1;
+  return true;
+}
+
+bool InputQueue::push(const InputEvent& event, uint64_t timestamp) {
+  const unsigned tail = m_tail.load(std::memory_order_relaxed);
+  if (tail - m_head.load(std::memory_order_acquire) > m_mask) {
+    m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  m_events[tail & m_mask] = {event, timestamp};
+  // 내용을 쓴 뒤에 tail 을 올려야 소비자가 완성된 이벤트를 봄
+  m_tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+const TimedInputEvent* InputQueue::peek() const {
+  const unsigned head = m_head.load(std::memory_order_relaxed);
+  if (head == m_tail.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  return &m_events[head & m_mask];
+}
+
+void InputQueue::pop() {
+  const unsigned head = m_head.load(std::memory_order_relaxed);
+  const uint64_t timestamp = m_events[head & m_mask].timestamp;
+  if (m_unpresentedCount++ == 0) {
+    m_oldestUnpresented = timestamp;
+  }
+  m_unpresentedSum += timestamp;
+  // 읽은 뒤에 head 를 올려야 생산자가 그 칸을 다시 씀
+  m_head.store(head + 1, std::memory_order_release);
+}
+
+void InputQueue::markPresented(uint64_t timestamp) {
+  if (m_unpresentedCount == 0) {
+    return;
+  }
+  // 각 이벤트의 (표시 시각 - 입력 시각) 합을 한번에 계산
+  m_totalLatency +=
+      (double)((uint64_t)m_unpresentedCount * timestamp - m_unpresentedSum);
+  const uint64_t maxLatency = timestamp - m_oldestUnpresented;
+  if (maxLatency > m_maxLatency) {
+    m_maxLatency = maxLatency;
+  }
+  m_presentedCount += m_unpresentedCount;
+  m_unpresentedCount = 0;
+  m_unpresentedSum = 0;
+}
+
+void InputQueue::report() const {
+  std::cout << "Input: " << m_presentedCount << " events";
+  if (m_presentedCount > 0) {
+    const double msPerCount = 1000.0 / m_frequency;
+    std::cout << ", input to present average "
+              << m_totalLatency / m_presentedCount * msPerCount << " ms, max "
+              << m_maxLatency * msPerCount << " ms";
+  }
+  if (droppedCount() > 0) {
+    std::cout << ", dropped " << droppedCount();
+  }
+  std::cout << "\n";
+}
+
+}  // namespace shmup
@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+// File: InputQueue.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "InputRecorder.hpp"
+
+namespace shmup {
+
+/// @brief 들어온 시각(퍼포먼스 카운터)이 붙은 입력 이벤트
+struct TimedInputEvent {
+  InputEvent event;
+  uint64_t timestamp;
+};
+
+/// @brief 입력을 받는 쪽과 시뮬레이션 사이의 단일 생산자/단일 소비자 링 버퍼.
+///
+/// - 생산자(이벤트 감시 콜백)는 push 만, 소비자(메인 루프)는 peek/pop 만 호출한다.
+///   잠금 없이 head/tail 두 인덱스로만 주고받는다.
+/// - 소비자는 이벤트 시각을 보고 그 시각이 속한 틱에서 꺼내 쓴다.
+/// - 꺼낸 이벤트는 다음 markPresented 에서 입력부터 화면 표시까지의 지연 시간으로 집계된다.
+class InputQueue {
+ public:
+  InputQueue();
+
+  ~InputQueue();
+
+  InputQueue(const InputQueue&) = delete;
+  InputQueue& operator=(const InputQueue&) = delete;
+
+  /// @brief capacity 는 2의 거듭제곱으로 올림. frequency 는 타임스탬프의 초당 카운트
+  bool init(unsigned capacity, uint64_t frequency);
+
+  /// @brief 생산자 전용. 가득 차면 버리고 false
+  bool push(const InputEvent& event, uint64_t timestamp);
+
+  /// @brief 소비자 전용. 가장 오래된 이벤트. 비어 있으면 nullptr
+  const TimedInputEvent* peek() const;
+
+  /// @brief 소비자 전용. peek 한 이벤트를 꺼냄
+  void pop();
+
+  /// @brief 지금까지 꺼낸 이벤트가 timestamp 에 화면에 표시됐다고 기록
+  void markPresented(uint64_t timestamp);
+
+  unsigned droppedCount() const { return m_droppedCount.load(); }
+
+  /// @brief 이벤트 수, 평균/최대 입력 지연 시간 출력
+  void report() const;
+
+ private:
+  TimedInputEvent* m_events = nullptr;
+
+  unsigned m_mask = 0;
+
+  // 소비자가 다음에 읽을 위치
+  alignas(64) std::atomic<unsigned> m_head{0};
+
+  // 생산자가 다음에 쓸 위치
+  alignas(64) std::atomic<unsigned> m_tail{0};
+
+  std::atomic<unsigned> m_droppedCount{0};
+
+  // 지연 시간 통계 (소비자 전용)
+  alignas(64) uint64_t m_frequency = 1;
+
+  // 꺼냈지만 아직 화면에 나오지 않은 이벤트 수, 시각의 합, 가장 이른 시각
+  unsigned m_unpresentedCount = 0;
+
+  uint64_t m_unpresentedSum = 0;
+
+  uint64_t m_oldestUnpresented = 0;
+
+  uint64_t m_presentedCount = 0;
+
+  double m_totalLatency = 0.0;
+
+  uint64_t m_maxLatency = 0;
+};
+
+}  // namespace shmup
@@ -0,0 +1,188 @@
+//------------------------------------------------------------------------------
+// File: InputRecorder.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "InputRecorder.hpp"
+
+#include <iostream>
+
+namespace shmup {
+
+namespace {
+constexpr uint32_t s_magic = 0x50524853;  // "SHRP"
+constexpr uint32_t s_version = 2;
+
+struct ReplayHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t seed;
+  uint32_t eventSize;
+};
+
+long fileSize(FILE* file) {
+  const long position = ftell(file);
+  fseek(file, 0, SEEK_END);
+  const long size = ftell(file);
+  fseek(file, position, SEEK_SET);
+  return size;
+}
+}  // namespace
+
+InputRecorder::InputRecorder() {}
+
+InputRecorder::~InputRecorder() { close(); }
+
+bool InputRecorder::openRecord(const char* path, uint32_t seed) {
+  close();
+  m_file = fopen(path, "wb");
+  if (m_file == nullptr) {
+    std::cout << "InputRecorder open failed: " << path << "\n";
+    return false;
+  }
+
+  const ReplayHeader header = {s_magic, s_version, seed,
+                               (uint32_t)sizeof(InputEvent)};
+  fwrite(&header, sizeof(header), 1, m_file);
+
+  m_mode = RecorderRecording;
+  m_seed = seed;
+  m_eventCount = 0;
+  m_frameCount = 0;
+  m_droppedEvents = 0;
+  return true;
+}
+
+bool InputRecorder::openReplay(const char* path) {
+  close();
+  m_file = fopen(path, "rb");
+  if (m_file == nullptr) {
+    std::cout << "InputRecorder open failed: " << path << "\n";
+    return false;
+  }
+
+  ReplayHeader header = {};
+  if (fread(&header, sizeof(header), 1, m_file) != 1 ||
+      header.magic != s_magic || header.version != s_version ||
+      header.eventSize != sizeof(InputEvent)) {
+    std::cout << "InputRecorder invalid replay file: " << path << "\n";
+    fclose(m_file);
+    m_file = nullptr;
+    return false;
+  }
+
+  // 재생 delta 를 바꾸면 한 프레임의 틱 수가 기록과 달라져서 이벤트를 기록된 프레임보다
+  // 먼저 또는 나중에 적용해야 하므로, 전체를 한번에 읽어서 틱 순서의 이벤트 목록으로 둠.
+  // 먼저 완전한 프레임 수와 이벤트 수를 세고 (잘린 마지막 프레임은 버림) 다시 처음부터 읽음
+  const long dataStart = ftell(m_file);
+  const long size = fileSize(m_file);
+  unsigned frameCount = 0;
+  unsigned eventCount = 0;
+  double delta = 0.0;
+  uint32_t count = 0;
+  while (fread(&delta, sizeof(delta), 1, m_file) == 1 &&
+         fread(&count, sizeof(count), 1, m_file) == 1 &&
+         count <= s_maxEventsPerFrame &&
+         fseek(m_file, (long)(count * sizeof(InputEvent)), SEEK_CUR) == 0 &&
+         ftell(m_file) <= size) {
+    ++frameCount;
+    eventCount += count;
+  }
+
+  m_replayDeltas = new double[frameCount > 0 ? frameCount : 1];
+  m_replayEvents = new InputEvent[eventCount > 0 ? eventCount : 1];
+  fseek(m_file, dataStart, SEEK_SET);
+  unsigned eventIndex = 0;
+  for (unsigned i = 0; i < frameCount; ++i) {
+    fread(&m_replayDeltas[i], sizeof(double), 1, m_file);
+    fread(&count, sizeof(count), 1, m_file);
+    fread(m_replayEvents + eventIndex, sizeof(InputEvent), count, m_file);
+    eventIndex += count;
+  }
+  fclose(m_file);
+  m_file = nullptr;
+
+  m_mode = RecorderReplaying;
+  m_seed = header.seed;
+  m_replayFrameCount = frameCount;
+  m_replayEventCount = eventCount;
+  m_replayCursor = 0;
+  m_frameCount = 0;
+  return true;
+}
+
+void InputRecorder::close() {
+  if (m_mode == RecorderOff) {
+    return;
+  }
+
+  if (m_mode == RecorderRecording) {
+    std::cout << "InputRecorder recorded " << m_frameCount << " frames";
+    if (m_droppedEvents > 0) {
+      std::cout << ", dropped " << m_droppedEvents << " events";
+    }
+    std::cout << "\n";
+  } else if (m_mode == RecorderReplaying) {
+    std::cout << "InputRecorder replayed " << m_frameCount << " frames\n";
+  }
+
+  if (m_file != nullptr) {
+    fclose(m_file);
+    m_file = nullptr;
+  }
+  delete[] m_replayDeltas;
+  m_replayDeltas = nullptr;
+  delete[] m_replayEvents;
+  m_replayEvents = nullptr;
+  m_replayFrameCount = 0;
+  m_replayEventCount = 0;
+  m_replayCursor = 0;
+  m_mode = RecorderOff;
+}
+
+void InputRecorder::recordEvent(const InputEvent& event) {
+  if (m_mode != RecorderRecording) {
+    return;
+  }
+  if (m_eventCount >= s_maxEventsPerFrame) {
+    ++m_droppedEvents;
+    return;
+  }
+  m_events[m_eventCount++] = event;
+}
+
+void InputRecorder::writeFrame(double delta) {
+  if (m_mode != RecorderRecording) {
+    return;
+  }
+  const uint32_t count = m_eventCount;
+  fwrite(&delta, sizeof(delta), 1, m_file);
+  fwrite(&count, sizeof(count), 1, m_file);
+  fwrite(m_events, sizeof(InputEvent), count, m_file);
+  m_eventCount = 0;
+  ++m_frameCount;
+}
+
+bool InputRecorder::readFrame() {
+  if (m_mode != RecorderReplaying || m_frameCount >= m_replayFrameCount) {
+    return false;
+  }
+  m_delta = m_replayDeltas[m_frameCount++];
+  return true;
+}
+
+const InputEvent* InputRecorder::nextEvent(uint32_t tick) {
+  if (m_mode != RecorderReplaying || m_replayCursor >= m_replayEventCount ||
+      m_replayEvents[m_replayCursor].tick > tick) {
+    return nullptr;
+  }
+  return &m_replayEvents[m_replayCursor++];
+}
+
+double InputRecorder::frameDelta() const {
+  return (m_fixedDelta > 0.0) ? m_fixedDelta : m_delta;
+}
+
+}  // namespace shmup
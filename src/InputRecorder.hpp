@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+// File: InputRecorder.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+namespace shmup {
+
+enum InputEventType : uint32_t {
+  InputEventOther = 0,
+  InputEventQuit,
+  InputEventKeyDown,
+  InputEventKeyUp,
+};
+
+/// @brief 게임 로직이 사용하는 입력 이벤트. SDL_Event 에서 필요한 값만 옮긴 것으로
+/// 파일에 그대로 기록할 수 있도록 고정 크기
+struct InputEvent {
+  uint32_t type;
+  int32_t key;  // SDL_Keycode
+
+  // 이벤트를 적용한 시뮬레이션 틱 번호. 재생할 때는 월드가 이 틱에 도달했을 때 적용
+  uint32_t tick;
+};
+
+enum RecorderMode {
+  RecorderOff,
+  RecorderRecording,
+  RecorderReplaying,
+};
+
+/// @brief 성능 비교를 같은 작업량으로 반복할 수 있도록 입력을 기록하고 재생.
+/// 파일 구성: 헤더(매직, 버전, 난수 시드) 다음에 프레임마다
+/// [delta(double), 이벤트 수(uint32), InputEvent * 이벤트 수]
+/// 재생할 때는 파일 전체를 읽어 두고, 프레임과 상관없이 이어지는 커서로 이벤트를
+/// 틱 번호 순서대로 꺼내므로 재생 delta 를 바꿔도 같은 틱에 적용된다.
+/// 재생 길이는 기록된 프레임 수이므로 delta 를 줄이면 뒤쪽 틱의 이벤트는 적용되지 않음.
+/// 바이트 순서는 기록한 머신 기준
+class InputRecorder {
+ public:
+  InputRecorder();
+
+  ~InputRecorder();
+
+  InputRecorder(const InputRecorder&) = delete;
+  InputRecorder& operator=(const InputRecorder&) = delete;
+
+  /// @brief 기록 시작. 시드를 헤더에 저장
+  bool openRecord(const char* path, uint32_t seed);
+
+  /// @brief 재생 시작. 헤더를 읽고 seed()로 기록 당시의 시드를 알려줌
+  bool openReplay(const char* path);
+
+  void close();
+
+  RecorderMode mode() const { return m_mode; }
+
+  bool isReplaying() const { return m_mode == RecorderReplaying; }
+
+  uint32_t seed() const { return m_seed; }
+
+  /// @brief 재생할 때 기록된 delta 대신 사용할 고정 delta(ms). 0이면 기록된 값 사용
+  void fixedDelta(double delta) { m_fixedDelta = delta; }
+
+  /// @brief 이번 프레임에 처리한 이벤트 기록
+  void recordEvent(const InputEvent& event);
+
+  /// @brief 이번 프레임의 delta 와 모아둔 이벤트를 파일에 씀
+  void writeFrame(double delta);
+
+  /// @brief 다음 프레임의 delta 로 넘어감. 기록된 프레임을 모두 재생했으면 false
+  bool readFrame();
+
+  /// @brief 재생 중인 프레임의 delta (고정 delta 가 있으면 그 값)
+  double frameDelta() const;
+
+  /// @brief 재생 중에 틱 번호가 tick 이하인 다음 이벤트를 꺼냄. 없으면 nullptr.
+  /// 커서는 프레임이 바뀌어도 유지되므로 아직 도달하지 않은 틱의 이벤트는 다음 호출까지 남음
+  const InputEvent* nextEvent(uint32_t tick);
+
+  unsigned frameCount() const { return m_frameCount; }
+
+ public:
+  // 한 프레임에 기록할 수 있는 최대 이벤트 수. 넘치는 이벤트는 버림
+  static constexpr unsigned s_maxEventsPerFrame = 64;
+
+ private:
+  FILE* m_file = nullptr;
+
+  RecorderMode m_mode = RecorderOff;
+
+  uint32_t m_seed = 0;
+
+  double m_delta = 0.0;
+
+  double m_fixedDelta = 0.0;
+
+  InputEvent m_events[s_maxEventsPerFrame];
+
+  unsigned m_eventCount = 0;
+
+  unsigned m_frameCount = 0;
+
+  unsigned m_droppedEvents = 0;
+
+  // 재생: 프레임마다의 delta 와 전체 이벤트 (openReplay 에서 한번에 읽음)
+  double* m_replayDeltas = nullptr;
+
+  InputEvent* m_replayEvents = nullptr;
+
+  unsigned m_replayFrameCount = 0;
+
+  unsigned m_replayEventCount = 0;
+
+  unsigned m_replayCursor = 0;
+};
+
+}  // namespace shmup
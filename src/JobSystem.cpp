@@ -0,0 +1,342 @@
+//------------------------------------------------------------------------------
+// File: JobSystem.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "JobSystem.hpp"
+
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace shmup {
+
+namespace {
+// 현재 스레드의 워커 번호. 워커가 아닌 스레드는 메인(0)으로 취급
+thread_local unsigned s_workerIndex = 0;
+
+// 일을 못 찾았을 때 잠들기 전에 양보하며 다시 찾는 횟수
+constexpr unsigned s_spinsBeforeSleep = 64;
+
+// 깨우는 신호를 놓쳐도 이 시간 뒤에는 다시 확인
+constexpr auto s_sleepTimeout = std::chrono::milliseconds(1);
+
+uint64_t nowNs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+}  // namespace
+
+//------------------------------------------------------------------------------
+// WorkStealingDeque
+//------------------------------------------------------------------------------
+
+bool JobSystem::WorkStealingDeque::push(Job* job) {
+  const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+  const int64_t top = m_top.load(std::memory_order_acquire);
+  if (bottom - top >= s_capacity) {
+    return false;
+  }
+  m_jobs[bottom & s_mask].store(job, std::memory_order_relaxed);
+  // 잡 내용을 쓴 뒤에 bottom 을 올려야 훔치는 쪽이 완성된 잡을 봄
+  m_bottom.store(bottom + 1, std::memory_order_release);
+  return true;
+}
+
+Job* JobSystem::WorkStealingDeque::pop() {
+  const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+  m_bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t top = m_top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // 비어 있음
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  Job* job = m_jobs[bottom & s_mask].load(std::memory_order_relaxed);
+  if (top == bottom) {
+    // 마지막 하나는 훔치는 쪽과 경쟁
+    if (m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed) == false) {
+      job = nullptr;
+    }
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return job;
+}
+
+Job* JobSystem::WorkStealingDeque::steal() {
+  int64_t top = m_top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+  if (top >= bottom) {
+    return nullptr;
+  }
+
+  Job* job = m_jobs[top & s_mask].load(std::memory_order_relaxed);
+  if (m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed) == false) {
+    return nullptr;
+  }
+  return job;
+}
+
+//------------------------------------------------------------------------------
+// JobSystem
+//------------------------------------------------------------------------------
+
+JobSystem::JobSystem() {}
+
+JobSystem::~JobSystem() {
+  shutdown();
+  if (m_workers) {
+    for (unsigned i = 0; i < m_workerCount; ++i) {
+      delete[] m_workers[i].jobs;
+    }
+  }
+  delete[] m_workers;
+  delete[] m_threads;
+}
+
+bool JobSystem::init(unsigned threadCount) {
+  if (threadCount == 0) {
+    threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0) threadCount = 1;
+  }
+
+  m_workers = new Worker[threadCount];
+  if (m_workers == nullptr) {
+    std::cout << "JobSystem allocate workers failed \n";
+    return false;
+  }
+  for (unsigned i = 0; i < threadCount; ++i) {
+    m_workers[i].jobs = new Job[s_jobsPerWorker];
+    if (m_workers[i].jobs == nullptr) {
+      std::cout << "JobSystem allocate jobs failed \n";
+      return false;
+    }
+    m_workers[i].randomState = 0x9E3779B9u * (i + 1);
+  }
+  m_workerCount = threadCount;
+
+  // 0번 워커는 init 을 호출한 메인 스레드
+  s_workerIndex = 0;
+  m_running.store(true);
+  m_startNs = nowNs();
+  m_threads = new std::thread[threadCount];
+  for (unsigned i = 1; i < threadCount; ++i) {
+    m_threads[i] = std::thread(&JobSystem::workerMain, this, i);
+  }
+  return true;
+}
+
+void JobSystem::shutdown() {
+  if (m_running.exchange(false) == false) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    m_sleepCondition.notify_all();
+  }
+  for (unsigned i = 1; i < m_workerCount; ++i) {
+    if (m_threads[i].joinable()) {
+      m_threads[i].join();
+    }
+  }
+}
+
+JobSystem::Worker& JobSystem::currentWorker() {
+  return m_workers[s_workerIndex];
+}
+
+Job* JobSystem::allocateJob() {
+  Worker& worker = currentWorker();
+  Job* job = &worker.jobs[worker.nextJob++ & (s_jobsPerWorker - 1)];
+
+  // 링을 한 바퀴 돌아온 슬롯이 아직 끝나지 않았으면 덮어쓸 수 없음.
+  // 기다려도 그 잡이 아직 run() 되지 않았을 수 있으므로 복구하지 않고 종료
+  if (isFinished(job) == false) {
+    std::cout << "JobSystem more than " << s_jobsPerWorker
+              << " live jobs on worker " << s_workerIndex << " \n"
+              << std::flush;
+    std::abort();
+  }
+  job->parent = nullptr;
+  job->unfinished.store(1, std::memory_order_relaxed);
+  job->pendingDependencies.store(1, std::memory_order_relaxed);
+  job->continuationCount.store(0, std::memory_order_relaxed);
+  return job;
+}
+
+Job* JobSystem::create(JobFunction function, const void* payload,
+                       size_t size) {
+  // 잘린 페이로드로 잡을 실행하면 안 되므로 잡을 만들지 않음
+  assert(size <= Job::s_payloadSize && "job payload too large");
+  if (size > Job::s_payloadSize) {
+    std::cout << "JobSystem payload too large: " << size << " bytes \n";
+    return nullptr;
+  }
+  Job* job = allocateJob();
+  job->function = function;
+  if (size > 0) {
+    std::memcpy(job->payload, payload, size);
+  }
+  return job;
+}
+
+Job* JobSystem::createChild(Job* parent, JobFunction function,
+                            const void* payload, size_t size) {
+  Job* job = create(function, payload, size);
+  if (job == nullptr) {
+    return nullptr;
+  }
+  parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+  job->parent = parent;
+  return job;
+}
+
+void JobSystem::addDependency(Job* job, Job* dependency) {
+  const unsigned index =
+      dependency->continuationCount.fetch_add(1, std::memory_order_relaxed);
+  if (index >= Job::s_maxContinuations) {
+    std::cout << "JobSystem too many continuations \n";
+    return;
+  }
+  job->pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+  dependency->continuations[index] = job;
+}
+
+void JobSystem::run(Job* job) {
+  if (job->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    push(job);
+  }
+}
+
+void JobSystem::push(Job* job) {
+  // 덱이 가득 찼으면 큐에 넣지 않고 바로 실행
+  if (currentWorker().deque.push(job) == false) {
+    execute(job);
+    return;
+  }
+  if (m_sleepers.load(std::memory_order_acquire) > 0) {
+    m_sleepCondition.notify_one();
+  }
+}
+
+void JobSystem::wait(const Job* job) {
+  Worker& worker = currentWorker();
+  while (isFinished(job) == false) {
+    Job* next = findJob(worker);
+    if (next) {
+      execute(next);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+Job* JobSystem::findJob(Worker& worker) {
+  Job* job = worker.deque.pop();
+  if (job || m_workerCount <= 1) {
+    return job;
+  }
+
+  // 임의의 워커부터 한바퀴 돌면서 훔침
+  uint32_t x = worker.randomState;
+  x ^= x << 13, x ^= x >> 17, x ^= x << 5;
+  worker.randomState = x;
+  const unsigned start = x % m_workerCount;
+  for (unsigned i = 0; i < m_workerCount; ++i) {
+    Worker& victim = m_workers[(start + i) % m_workerCount];
+    if (&victim == &worker) {
+      continue;
+    }
+    job = victim.deque.steal();
+    if (job) {
+      worker.stolen.fetch_add(1, std::memory_order_relaxed);
+      return job;
+    }
+  }
+  return nullptr;
+}
+
+void JobSystem::execute(Job* job) {
+  job->function(job, job->payload);
+  currentWorker().executed.fetch_add(1, std::memory_order_relaxed);
+  finish(job);
+}
+
+void JobSystem::finish(Job* job) {
+  if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+
+  // 자식까지 모두 끝났으면 후속 잡을 풀어주고 부모에게 알림
+  const unsigned count = job->continuationCount.load(std::memory_order_acquire);
+  for (unsigned i = 0; i < count && i < Job::s_maxContinuations; ++i) {
+    run(job->continuations[i]);
+  }
+  if (job->parent) {
+    finish(job->parent);
+  }
+}
+
+void JobSystem::workerMain(unsigned index) {
+  s_workerIndex = index;
+  Worker& worker = m_workers[index];
+
+  unsigned misses = 0;
+  uint64_t idleStart = nowNs();
+  while (m_running.load(std::memory_order_acquire)) {
+    Job* job = findJob(worker);
+    if (job) {
+      if (misses > 0) {
+        worker.idleNs.fetch_add(nowNs() - idleStart, std::memory_order_relaxed);
+        misses = 0;
+      }
+      execute(job);
+      continue;
+    }
+
+    if (misses++ == 0) {
+      idleStart = nowNs();
+    }
+    if (misses < s_spinsBeforeSleep) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    // 오래 일이 없으면 새 잡이 들어올 때까지 잠듦
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    m_sleepers.fetch_add(1, std::memory_order_acq_rel);
+    m_sleepCondition.wait_for(lock, s_sleepTimeout);
+    m_sleepers.fetch_sub(1, std::memory_order_acq_rel);
+  }
+  if (misses > 0) {
+    worker.idleNs.fetch_add(nowNs() - idleStart, std::memory_order_relaxed);
+  }
+}
+
+void JobSystem::report() const {
+  const double elapsedNs = (double)(nowNs() - m_startNs);
+  std::cout << "JobSystem: " << m_workerCount << " threads\n";
+  for (unsigned i = 0; i < m_workerCount; ++i) {
+    const Worker& worker = m_workers[i];
+    std::cout << "  worker " << i << ": jobs " << worker.executed.load()
+              << ", stolen " << worker.stolen.load();
+    // 메인 스레드는 잡 사이에 게임 루프를 돌므로 쉰 시간을 따로 재지 않음
+    if (i > 0 && elapsedNs > 0.0) {
+      std::cout << ", idle " << 100.0 * worker.idleNs.load() / elapsedNs
+                << "%";
+    }
+    std::cout << "\n";
+  }
+}
+
+}  // namespace shmup
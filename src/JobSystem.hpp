@@ -0,0 +1,234 @@
+//------------------------------------------------------------------------------
+// File: JobSystem.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace shmup {
+
+struct Job;
+
+/// data 는 잡을 만들 때 복사해 둔 페이로드
+using JobFunction = void (*)(Job* job, const void* data);
+
+/// @brief 잡 하나. 워커별 링 버퍼에서 잘라 쓰며 직접 만들지 않음
+struct alignas(64) Job {
+  static constexpr unsigned s_maxContinuations = 8;
+  static constexpr unsigned s_payloadSize = 64;
+
+  JobFunction function;
+
+  Job* parent;
+
+  // 자신과 아직 끝나지 않은 자식 잡의 수. 0 이 되면 끝난 것
+  std::atomic<int> unfinished;
+
+  // 선행 잡 수 + 1 (run 호출). 0 이 되는 순간 큐에 들어감
+  std::atomic<int> pendingDependencies;
+
+  // 이 잡이 끝나면 선행 잡 하나를 덜어낼 후속 잡
+  Job* continuations[s_maxContinuations];
+
+  std::atomic<unsigned> continuationCount;
+
+  alignas(16) unsigned char payload[s_payloadSize];
+};
+
+/// @brief 워커 스레드마다 Chase–Lev 덱을 두는 작업 훔치기(work stealing) 스케줄러.
+///
+/// - 잡을 만든 워커는 자기 덱의 아래쪽에 넣고 꺼내며(LIFO), 일이 없는 워커는
+///   다른 워커 덱의 위쪽에서 훔친다(FIFO).
+/// - 메인 스레드는 0번 워커이며 wait() 하는 동안 다른 잡을 대신 실행하므로
+///   잡 안에서 다시 잡을 만들고 기다려도 된다.
+/// - 잡은 워커별 고정 링 버퍼에서 할당하므로 실행 중 힙 할당이 없다.
+///   한 워커가 끝나지 않은 잡을 s_jobsPerWorker 개보다 많이 가지면 프로그램을 종료한다.
+class JobSystem {
+ public:
+  JobSystem();
+
+  ~JobSystem();
+
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+
+  /// @brief threadCount 는 메인 스레드를 포함한 전체 워커 수. 0 이면 코어 수
+  bool init(unsigned threadCount);
+
+  /// @brief 워커 스레드를 모두 종료. 소멸자에서도 호출됨
+  void shutdown();
+
+  unsigned threadCount() const { return m_workerCount; }
+
+  /// @brief 잡 생성. payload 는 size 바이트만큼 잡 안에 복사됨.
+  /// 페이로드 타입이 정해진 호출은 Job::s_payloadSize 를 static_assert 로 확인할 것
+  /// @return size 가 Job::s_payloadSize 보다 크면 nullptr (디버그 빌드에서는 assert)
+  Job* create(JobFunction function, const void* payload = nullptr,
+              size_t size = 0);
+
+  /// @brief parent 가 끝나려면 이 잡도 끝나야 하는 자식 잡 생성
+  Job* createChild(Job* parent, JobFunction function,
+                   const void* payload = nullptr, size_t size = 0);
+
+  /// @brief job 이 dependency 가 끝난 뒤에 실행되도록 연결.
+  /// 두 잡 모두 run() 하기 전에 호출해야 함
+  void addDependency(Job* job, Job* dependency);
+
+  /// @brief 실행 예약. 선행 잡이 남아 있으면 그것들이 끝날 때 큐에 들어감
+  void run(Job* job);
+
+  /// @brief job 과 그 자식이 끝날 때까지 다른 잡을 실행하면서 기다림
+  void wait(const Job* job);
+
+  bool isFinished(const Job* job) const {
+    return job->unfinished.load(std::memory_order_acquire) == 0;
+  }
+
+  /// @brief [begin, end) 를 grain 개 이하의 구간으로 나눠서 fn(first, last) 를
+  /// 병렬로 호출하고 모두 끝날 때까지 기다림. 구간은 겹치지 않음
+  template <typename Fn>
+  void parallelFor(unsigned begin, unsigned end, unsigned grain, const Fn& fn);
+
+  /// @brief 워커별 실행한 잡 수, 훔친 잡 수, 쉰 시간 비율 출력
+  void report() const;
+
+ private:
+  /// @brief Chase–Lev 덱. 소유 워커만 push/pop 하고 나머지는 steal 만 함
+  class WorkStealingDeque {
+   public:
+    static constexpr int64_t s_capacity = 4096;
+
+    bool push(Job* job);
+
+    Job* pop();
+
+    Job* steal();
+
+   private:
+    static constexpr int64_t s_mask = s_capacity - 1;
+
+    alignas(64) std::atomic<int64_t> m_top{0};
+
+    alignas(64) std::atomic<int64_t> m_bottom{0};
+
+    std::atomic<Job*> m_jobs[s_capacity];
+  };
+
+  struct alignas(64) Worker {
+    WorkStealingDeque deque;
+
+    Job* jobs = nullptr;
+
+    unsigned nextJob = 0;
+
+    uint32_t randomState = 0;
+
+    // 통계: 스레드 하나만 쓰므로 atomic 은 report 에서 읽기 위한 것
+    std::atomic<uint64_t> executed{0};
+
+    std::atomic<uint64_t> stolen{0};
+
+    std::atomic<uint64_t> idleNs{0};
+  };
+
+  static constexpr unsigned s_jobsPerWorker = 4096;
+
+  template <typename Fn>
+  struct ParallelForPayload {
+    JobSystem* system;
+    const Fn* fn;
+    unsigned begin;
+    unsigned end;
+    unsigned grain;
+  };
+
+  template <typename Fn>
+  static void parallelForJob(Job* job, const void* data);
+
+  Worker& currentWorker();
+
+  Job* allocateJob();
+
+  void push(Job* job);
+
+  /// @brief 자기 덱에서 꺼내거나 다른 워커에게서 훔침. 없으면 nullptr
+  Job* findJob(Worker& worker);
+
+  void execute(Job* job);
+
+  void finish(Job* job);
+
+  void workerMain(unsigned index);
+
+ private:
+  Worker* m_workers = nullptr;
+
+  std::thread* m_threads = nullptr;
+
+  unsigned m_workerCount = 0;
+
+  std::atomic<bool> m_running{false};
+
+  // 일이 없는 워커를 재우고 깨우는 데 사용
+  std::mutex m_sleepMutex;
+
+  std::condition_variable m_sleepCondition;
+
+  std::atomic<int> m_sleepers{0};
+
+  uint64_t m_startNs = 0;
+};
+
+template <typename Fn>
+void JobSystem::parallelFor(unsigned begin, unsigned end, unsigned grain,
+                            const Fn& fn) {
+  if (begin >= end) {
+    return;
+  }
+  if (grain == 0) {
+    grain = 1;
+  }
+  // 한 구간이면 잡을 만들지 않고 바로 실행
+  if (end - begin <= grain || m_workerCount <= 1) {
+    fn(begin, end);
+    return;
+  }
+  static_assert(sizeof(ParallelForPayload<Fn>) <= Job::s_payloadSize,
+                "parallelFor payload does not fit in a job");
+  const ParallelForPayload<Fn> payload = {this, &fn, begin, end, grain};
+  Job* root = create(&parallelForJob<Fn>, &payload, sizeof(payload));
+  run(root);
+  wait(root);
+}
+
+template <typename Fn>
+void JobSystem::parallelForJob(Job* job, const void* data) {
+  static_assert(sizeof(ParallelForPayload<Fn>) <= Job::s_payloadSize,
+                "parallelFor payload does not fit in a job");
+  ParallelForPayload<Fn> range;
+  std::memcpy(&range, data, sizeof(range));
+
+  // 구간이 grain 보다 크면 반으로 나눠서 자식 잡으로 넘기고 나머지를 계속 나눔
+  while (range.end - range.begin > range.grain) {
+    const unsigned middle = range.begin + (range.end - range.begin) / 2;
+    ParallelForPayload<Fn> right = range;
+    right.begin = middle;
+    range.end = middle;
+    range.system->run(
+        range.system->createChild(job, &parallelForJob<Fn>, &right, sizeof(right)));
+  }
+  (*range.fn)(range.begin, range.end);
+}
+
+}  // namespace shmup
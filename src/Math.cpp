@@ -7,55 +7,115 @@
 
 #include "Math.hpp"
 
+#include <iostream>
+
+#include "Simd.hpp"
+
 namespace shmup {
 
-Vector2::Vector2() : x(0.0f), y(0.0f) {}
+// 배열 버전은 Vector2 배열을 [x0, y0, x1, y1, ...] 형태의 연속된 float 배열로 보고
+// 좌표 두 개(float 4개)씩 처리함
 
-Vector2::Vector2(float x, float y) : x(x), y(y) {}
+void Math::translate(Vector2* points, unsigned count, const Vector2& offset) {
+  using namespace simd;
 
-Vector2 Vector2::operator+(const Vector2& other) const {
-  return { x + other.x, y + other.y };
-}
+  float* p = reinterpret_cast<float*>(points);
+  const float offsets[4] = {offset.x, offset.y, offset.x, offset.y};
+  const float4 offset4 = load(offsets);
+  const size_t n = (size_t)count * 2;
 
-Vector2 Vector2::operator*(float scalar) const {
-  return { x * scalar, y * scalar };
+  // 레지스터 두 개씩 처리해서 반복마다 드는 인덱스 계산과 분기를 절반으로 줄임.
+  // 인덱스를 size_t 로 두어야 32비트 인덱스를 매번 확장하는 코드가 생기지 않음
+  size_t i = 0;
+  for (; i + 2 * s_width <= n; i += 2 * s_width) {
+    const float4 p0 = load(p + i);
+    const float4 p1 = load(p + i + s_width);
+    store(p + i, add(p0, offset4));
+    store(p + i + s_width, add(p1, offset4));
+  }
+  for (; i < n; i += 2) {
+    p[i] += offset.x;
+    p[i + 1] += offset.y;
+  }
 }
 
-Vector2& Vector2::operator=(const Vector2& other) {
-  x = other.x;
-  y = other.y;
-  return *this;
-}
+void Math::lerp(const Vector2* a, const Vector2* b, unsigned count, float t,
+                Vector2* out) {
+  using namespace simd;
 
-Vector2 Vector2::operator-(const Vector2& other) const {
-  return { x - other.x, y - other.y };
-}
+  const float* from = reinterpret_cast<const float*>(a);
+  const float* to = reinterpret_cast<const float*>(b);
+  float* result = reinterpret_cast<float*>(out);
+  const float4 t4 = set1(t);
+  const size_t n = (size_t)count * 2;
 
-bool Vector2::operator==(const Vector2& other) const {
-  return (x == other.x) && (y == other.y);
+  size_t i = 0;
+  for (; i + 2 * s_width <= n; i += 2 * s_width) {
+    const float4 start0 = load(from + i);
+    const float4 start1 = load(from + i + s_width);
+    store(result + i, madd(sub(load(to + i), start0), t4, start0));
+    store(result + i + s_width,
+          madd(sub(load(to + i + s_width), start1), t4, start1));
+  }
+  for (; i < n; ++i) {
+    result[i] = from[i] + (to[i] - from[i]) * t;
+  }
 }
 
-float Vector2::magnitude() const {
-  return sqrtf(x * x + y * y);
-}
+void Math::scaleTranslate(const Vector2* points, unsigned count, float scale,
+                          const Vector2& offset, Vector2* out) {
+  using namespace simd;
 
-Vector2 Vector2::normalized() const {
-  float mag = magnitude();
-  return { x / mag, y / mag };
+  const float* from = reinterpret_cast<const float*>(points);
+  float* result = reinterpret_cast<float*>(out);
+  const float offsets[4] = {offset.x, offset.y, offset.x, offset.y};
+  const float4 offset4 = load(offsets);
+  const float4 scale4 = set1(scale);
+  const size_t n = (size_t)count * 2;
+
+  size_t i = 0;
+  for (; i + 2 * s_width <= n; i += 2 * s_width) {
+    const float4 p0 = load(from + i);
+    const float4 p1 = load(from + i + s_width);
+    store(result + i, madd(p0, scale4, offset4));
+    store(result + i + s_width, madd(p1, scale4, offset4));
+  }
+  for (; i < n; i += 2) {
+    result[i] = from[i] * scale + offset.x;
+    result[i + 1] = from[i + 1] * scale + offset.y;
+  }
 }
 
-float Math::distance(const Vector2& a, const Vector2& b) {
-  return (float)std::sqrtf(std::fabsf(a.x - b.x) * std::fabsf(a.x - b.x) +
-                          std::fabsf(a.y - b.y) * std::fabsf(a.y - b.y));
+CircleTable::CircleTable() {}
+
+CircleTable::~CircleTable() { delete[] m_points; }
+
+bool CircleTable::init(unsigned segments) {
+  if (segments == 0) {
+    std::cout << "CircleTable segments must be positive \n";
+    return false;
+  }
+  delete[] m_points;
+  m_points = new Vector2[segments];
+  if (m_points == nullptr) {
+    std::cout << "CircleTable allocate points failed \n";
+    return false;
+  }
+  m_segments = segments;
+
+  // 각도는 라디안. 누적하지 않고 매번 곱해서 오차가 쌓이지 않게 함
+  const double step = 6.283185307179586 / segments;  // 2π / N
+  for (unsigned i = 0; i < segments; ++i) {
+    m_points[i] = {(float)std::cos(step * i), (float)std::sin(step * i)};
+  }
+  return true;
 }
 
-void Math::createCirclePoints(Vector2* points, float x, float y,
-                              float radius) {
-  float angle = 0.0f;
-  const float stepSize = 2.0f;
-  for (int i = 0; i < 180; ++i, angle += stepSize) {
-    points[i] =
-        {x + std::cosf(angle) * radius, y + std::sinf(angle) * radius};
+void CircleTable::outline(const Vector2* centers, const float* radii,
+                          unsigned count, Vector2* out) const {
+  for (unsigned i = 0; i < count; ++i) {
+    Math::scaleTranslate(m_points, m_segments, radii[i], centers[i],
+                         out + i * m_segments);
   }
 }
 
@@ -7,40 +7,106 @@
 
 #pragma once
 
-#include <vector>
-#include <cstdlib>
 #include <cmath>
 
 namespace shmup {
 
+/// @brief 2차원 벡터. 연산자는 모두 인라인이라 루프 안에서 함수 호출이 생기지 않음
 struct Vector2 {
   float x;
   float y;
 
-  Vector2();
-  Vector2(float x, float y);
+  constexpr Vector2() : x(0.0f), y(0.0f) {}
+  constexpr Vector2(float x, float y) : x(x), y(y) {}
 
-  Vector2 operator+(const Vector2& other) const;
-  Vector2 operator*(float scalar) const;
-  Vector2& operator=(const Vector2& other);
-  Vector2 operator-(const Vector2& other) const;
-  bool operator==(const Vector2& other) const;
+  constexpr Vector2 operator+(const Vector2& other) const {
+    return {x + other.x, y + other.y};
+  }
+  constexpr Vector2 operator*(float scalar) const {
+    return {x * scalar, y * scalar};
+  }
+  constexpr Vector2 operator-(const Vector2& other) const {
+    return {x - other.x, y - other.y};
+  }
+  constexpr bool operator==(const Vector2& other) const {
+    return (x == other.x) && (y == other.y);
+  }
+
+  /// @brief 벡터 크기의 제곱. 크기를 비교할 때는 sqrt 가 필요 없는 이쪽을 사용
+  constexpr float lengthSq() const { return x * x + y * y; }
 
   /// @brief 벡터의 크기 계산
-  float magnitude() const;
+  float length() const { return std::sqrt(lengthSq()); }
 
   /// @brief 벡터 노멀라이즈 (정규화)
-  Vector2 normalized() const;
+  Vector2 normalized() const {
+    const float len = length();
+    return {x / len, y / len};
+  }
 };
 
 /// @brief 간단한 수학 메서드 제공
+///
+/// 배열 버전은 (포인터, 개수) 로 받은 좌표 N개를 SIMD 로 한번에 처리한다.
+/// 입력과 출력 배열은 정렬하지 않아도 되고, 같은 배열을 넘겨도 된다.
 class Math {
 public:
+  /// @brief 두 좌표 간의 거리 제곱. 반지름 합의 제곱과 비교하면 sqrt 없이 충돌 검사 가능
+  static constexpr float distanceSq(const Vector2& a, const Vector2& b) {
+    return (a - b).lengthSq();
+  }
+
   /// @brief 두 좌표 간의 거리
-  static float distance(const Vector2& a, const Vector2& b);
+  static float distance(const Vector2& a, const Vector2& b) {
+    return std::sqrt(distanceSq(a, b));
+  }
+
+  /// @brief a에서 b까지 t(0 ~ 1) 비율만큼 선형 보간
+  static constexpr Vector2 lerp(const Vector2& a, const Vector2& b, float t) {
+    return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t};
+  }
+
+  /// @brief points 의 모든 좌표를 offset 만큼 이동
+  static void translate(Vector2* points, unsigned count, const Vector2& offset);
+
+  /// @brief a[i] 에서 b[i] 까지 t 비율만큼 보간한 좌표를 out[i] 에 씀
+  static void lerp(const Vector2* a, const Vector2* b, unsigned count, float t,
+                   Vector2* out);
+
+  /// @brief 모든 좌표에 scale 을 곱한 뒤 offset 만큼 이동해서 out 에 씀
+  static void scaleTranslate(const Vector2* points, unsigned count, float scale,
+                             const Vector2& offset, Vector2* out);
+};
+
+/// @brief 반지름 1인 원 위의 점 테이블.
+///
+/// 삼각함수는 init 에서 한번만 계산하고, 원 외곽선은 테이블을 반지름만큼 키워서
+/// 중심으로 옮기기만 하므로 매 프레임 cos/sin 을 호출하지 않는다.
+class CircleTable {
+public:
+  CircleTable();
+
+  ~CircleTable();
+
+  CircleTable(const CircleTable&) = delete;
+  CircleTable& operator=(const CircleTable&) = delete;
+
+  /// @brief 원 하나를 segments 개의 점으로 나눈 테이블 생성
+  bool init(unsigned segments);
+
+  unsigned segments() const { return m_segments; }
+
+  const Vector2* points() const { return m_points; }
+
+  /// @brief 원 count 개의 외곽선을 out 에 차례로 채움.
+  /// out 에는 count * segments() 개의 자리가 있어야 함
+  void outline(const Vector2* centers, const float* radii, unsigned count,
+               Vector2* out) const;
+
+private:
+  Vector2* m_points = nullptr;
 
-  /// @brief 정해진 좌표를 중심으로 주어진 반지름으로 구성된 원 좌표를 반환 (좌표 갯수는 항상 180개로 고정)
-  static void createCirclePoints(Vector2* points, float x, float y, float radius);
+  unsigned m_segments = 0;
 };
 
 
@@ -0,0 +1,189 @@
+//------------------------------------------------------------------------------
+// File: ObjectPool.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Snapshot.hpp"
+
+namespace shmup {
+
+/// @brief 풀 슬롯을 가리키는 핸들. 슬롯이 반환되면 세대가 올라가서 무효가 된다.
+struct PoolHandle {
+  uint32_t slot;
+  uint32_t generation;
+};
+
+/// @brief 고정 용량 오브젝트 풀
+/// - acquire: 프리 리스트(스택)에서 슬롯을 꺼내므로 O(1)
+/// - release: 살아있는 슬롯 목록에서 마지막 항목과 바꿔 빼므로 O(1)
+/// - 순회: 살아있는 슬롯 인덱스가 [0, liveCount) 구간에 빽빽하게 모여 있음
+/// 오브젝트는 init 시점에 한번만 생성되고 재사용되므로
+/// acquire 후 필요한 값은 호출한 쪽에서 다시 설정해야 함.
+/// 순회 중에 release 하려면 역순으로 돌아야 한다.
+template <typename T>
+class ObjectPool {
+ public:
+  ObjectPool() = default;
+
+  ~ObjectPool() {
+    delete[] m_items;
+    delete[] m_generations;
+    delete[] m_freeSlots;
+    delete[] m_liveSlots;
+    delete[] m_livePositions;
+  }
+
+  ObjectPool(const ObjectPool&) = delete;
+  ObjectPool& operator=(const ObjectPool&) = delete;
+
+  bool init(unsigned capacity) {
+    m_items = new T[capacity];
+    m_generations = new uint32_t[capacity];
+    m_freeSlots = new uint32_t[capacity];
+    m_liveSlots = new uint32_t[capacity];
+    m_livePositions = new uint32_t[capacity];
+    if (m_items == nullptr || m_generations == nullptr ||
+        m_freeSlots == nullptr || m_liveSlots == nullptr ||
+        m_livePositions == nullptr) {
+      return false;
+    }
+
+    m_capacity = capacity;
+    m_liveCount = 0;
+    m_freeCount = capacity;
+    for (unsigned i = 0; i < capacity; ++i) {
+      m_generations[i] = 0;
+      // 낮은 슬롯부터 꺼내지도록 역순으로 쌓음
+      m_freeSlots[i] = capacity - 1 - i;
+    }
+    return true;
+  }
+
+  /// @brief 빈 슬롯 하나를 살아있는 상태로 만들고 반환. 가득 찼으면 nullptr.
+  T* acquire(PoolHandle* outHandle = nullptr) {
+    if (m_freeCount == 0) {
+      return nullptr;
+    }
+    const uint32_t slot = m_freeSlots[--m_freeCount];
+    m_livePositions[slot] = m_liveCount;
+    m_liveSlots[m_liveCount++] = slot;
+
+    if (outHandle != nullptr) {
+      *outHandle = {slot, m_generations[slot]};
+    }
+    return &m_items[slot];
+  }
+
+  /// @brief live(liveIndex) 오브젝트를 풀에 돌려줌
+  void releaseLive(unsigned liveIndex) {
+    if (liveIndex >= m_liveCount) {
+      return;
+    }
+    const uint32_t slot = m_liveSlots[liveIndex];
+
+    // 마지막 살아있는 슬롯을 빈 자리로 옮김
+    const uint32_t lastSlot = m_liveSlots[--m_liveCount];
+    m_liveSlots[liveIndex] = lastSlot;
+    m_livePositions[lastSlot] = liveIndex;
+
+    // 세대를 올려서 이 슬롯을 가리키던 핸들을 무효화
+    ++m_generations[slot];
+    m_freeSlots[m_freeCount++] = slot;
+  }
+
+  /// @brief 핸들이 가리키는 오브젝트를 풀에 돌려줌. 이미 무효한 핸들이면 무시.
+  void release(PoolHandle handle) {
+    if (isAlive(handle)) {
+      releaseLive(m_livePositions[handle.slot]);
+    }
+  }
+
+  bool isAlive(PoolHandle handle) const {
+    return handle.slot < m_capacity &&
+           m_generations[handle.slot] == handle.generation;
+  }
+
+  /// @brief 핸들이 가리키는 오브젝트, 무효한 핸들이면 nullptr
+  T* get(PoolHandle handle) {
+    return isAlive(handle) ? &m_items[handle.slot] : nullptr;
+  }
+
+  /// @brief liveIndex 번째 살아있는 오브젝트의 핸들.
+  /// 순회 중 release로 순서가 바뀌어도 오브젝트를 다시 찾을 때 사용
+  PoolHandle handle(unsigned liveIndex) const {
+    const uint32_t slot = m_liveSlots[liveIndex];
+    return {slot, m_generations[slot]};
+  }
+
+  /// @brief 살아있는 오브젝트 중 liveIndex 번째
+  T& live(unsigned liveIndex) { return m_items[m_liveSlots[liveIndex]]; }
+
+  const T& live(unsigned liveIndex) const {
+    return m_items[m_liveSlots[liveIndex]];
+  }
+
+  unsigned liveCount() const { return m_liveCount; }
+
+  unsigned capacity() const { return m_capacity; }
+
+  /// @brief save() 가 쓰는 최대 바이트 수
+  size_t snapshotCapacity() const {
+    return sizeof(unsigned) * 2 +
+           (sizeof(T) + sizeof(uint32_t) * 3) * m_capacity;
+  }
+
+  /// @brief 살아있는 오브젝트는 순회 순서대로, 슬롯 상태는 핸들이 유지되도록 그대로 기록
+  void save(SnapshotWriter& writer) const {
+    writer.write(m_liveCount);
+    writer.write(m_freeCount);
+    writer.writeArray(m_generations, m_capacity);
+    writer.writeArray(m_liveSlots, m_liveCount);
+    writer.writeArray(m_freeSlots, m_freeCount);
+    for (unsigned i = 0; i < m_liveCount; ++i) {
+      writer.write(m_items[m_liveSlots[i]]);
+    }
+  }
+
+  /// @brief 같은 용량으로 초기화된 풀에서만 사용
+  void restore(SnapshotReader& reader) {
+    reader.read(&m_liveCount);
+    reader.read(&m_freeCount);
+    reader.readArray(m_generations, m_capacity);
+    reader.readArray(m_liveSlots, m_liveCount);
+    reader.readArray(m_freeSlots, m_freeCount);
+    for (unsigned i = 0; i < m_liveCount; ++i) {
+      const uint32_t slot = m_liveSlots[i];
+      reader.read(&m_items[slot]);
+      m_livePositions[slot] = i;
+    }
+  }
+
+  /// @brief 초기 설정처럼 살아있는지와 상관없이 모든 슬롯을 다룰 때 사용
+  T* items() { return m_items; }
+
+ private:
+  T* m_items = nullptr;
+
+  uint32_t* m_generations = nullptr;
+
+  uint32_t* m_freeSlots = nullptr;
+
+  uint32_t* m_liveSlots = nullptr;
+
+  uint32_t* m_livePositions = nullptr;
+
+  unsigned m_capacity = 0;
+
+  unsigned m_liveCount = 0;
+
+  unsigned m_freeCount = 0;
+};
+
+}  // namespace shmup
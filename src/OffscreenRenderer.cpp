@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// File: OffscreenRenderer.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "OffscreenRenderer.hpp"
+
+#include <cstdio>
+
+#include "TGA.hpp"
+
+namespace shmup {
+
+OffscreenRenderer::OffscreenRenderer() {}
+
+OffscreenRenderer::~OffscreenRenderer() {}
+
+bool OffscreenRenderer::init(int width, int height, const char* frameDirectory,
+                             unsigned interval) {
+  if (initScreenBuffer(width, height) == false) {
+    return false;
+  }
+  m_frameDirectory = frameDirectory;
+  m_interval = interval > 0 ? interval : 1;
+  return true;
+}
+
+void OffscreenRenderer::presentScreenBuffer() {
+  const unsigned frame = m_frameCount++;
+  if (m_frameDirectory == nullptr || frame % m_interval != 0) {
+    return;
+  }
+
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/frame_%06u.tga", m_frameDirectory, frame);
+  if (TGA::writeToFile(path, screenBuffer(), width(), height()) == false) {
+    // 폴더가 없거나 디스크가 가득 찼으면 매 프레임 실패하지 않도록 저장을 멈춤
+    m_frameDirectory = nullptr;
+    return;
+  }
+  ++m_writtenCount;
+}
+
+}  // namespace shmup
@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+// File: OffscreenRenderer.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Renderer.hpp"
+
+namespace shmup {
+
+/// @brief 창 없이 화면 버퍼에만 합성하는 헤드리스 백엔드.
+///
+/// 텍스처 업로드와 표시를 하지 않으므로 GPU 나 디스플레이가 없는 서버에서도
+/// 전체 프레임 합성 비용을 잴 수 있다. 저장할 폴더를 주면 interval 프레임마다
+/// frame_000000.tga 형식의 파일로 씀.
+class OffscreenRenderer : public Renderer {
+ public:
+  OffscreenRenderer();
+
+  ~OffscreenRenderer() override;
+
+  /// @brief frameDirectory 가 nullptr 이면 저장하지 않음. interval 0 은 1 로 취급
+  bool init(int width, int height, const char* frameDirectory = nullptr,
+            unsigned interval = 1);
+
+  /// @brief 프레임 수를 세고, 저장할 차례이면 화면 버퍼를 파일로 씀
+  void presentScreenBuffer() override;
+
+  /// @brief 지금까지 내보낸 프레임 수
+  unsigned frameCount() const { return m_frameCount; }
+
+  /// @brief 지금까지 파일로 쓴 프레임 수
+  unsigned writtenCount() const { return m_writtenCount; }
+
+ private:
+  const char* m_frameDirectory = nullptr;
+
+  unsigned m_interval = 1;
+
+  unsigned m_frameCount = 0;
+
+  unsigned m_writtenCount = 0;
+};
+
+}  // namespace shmup
@@ -11,7 +11,7 @@
 #include <iostream>
 
 #include "Math.hpp"
-#include "SDLProgram.hpp"
+#include "Snapshot.hpp"
 
 namespace shmup {
 
@@ -28,14 +28,7 @@ constexpr auto s_planeFilepath = "../../resources/plane.tga";
 constexpr auto s_bulletFilepath = "../../resources/bullet.tga";
 #endif
 
-unsigned s_bulletMaxYPos = 0;
-float s_bulletColliderRadius = 3.0f;
-unsigned s_maximumBulletCount = 1000;  // 총알 최대 갯수
-
-float s_playerSpeed = 0.5f;
-float s_playerColliderRadius = 0.0f;
-float s_playerFireDelay = 10.0f;
-float s_playerMaxXPos = 0.0f;
+constexpr float s_bulletColliderRadius = 3.0f;
 
 ///////////////////////////////////////////////////////////////
 /// Player
@@ -53,31 +46,20 @@ Player::~Player() {
   if (m_bulletTexture) {
     delete m_bulletTexture;
   }
-  if (m_bullets) {
-    delete[] m_bullets;
-  }
-  if (m_debugColliderPoints) {
-    delete[] m_debugColliderPoints;
-  }
 }
 
-bool Player::loadResource(SDL_Renderer* renderer) {
+bool Player::loadResource(int width, const GameConfig& config) {
+  m_config = &config;
+
   // load plane texture
   m_planeTexture = new TGA();
   if (m_planeTexture->readFromFile(s_planeFilepath) == false) {
     return false;
   }
 
-  if (m_planeTexture->createTexture(renderer) == false) {
-    return false;
-  }
-  s_playerColliderRadius = (float)m_planeTexture->header()->width / 4;
+  m_colliderRadius = (float)m_planeTexture->header()->width / 4;
 
-  setCollider(0.0f, 0.0f, s_playerColliderRadius);
-
-  m_debugColliderPoints = new Vector2[180];
-  Math::createCirclePoints(m_debugColliderPoints, 0.0f, 0.0f,
-                           m_planeTexture->header()->width / 2);
+  setCollider(0.0f, 0.0f, m_colliderRadius);
 
   m_size = { (float)m_planeTexture->header()->width, (float)m_planeTexture->header()->height };
 
@@ -87,20 +69,13 @@ bool Player::loadResource(SDL_Renderer* renderer) {
     return false;
   }
 
-  if (m_bulletTexture->createTexture(renderer) == false) {
+  m_maxXPos = width - m_planeTexture->header()->width;
+
+  // 총알 풀 용량은 설정 값
+  if (m_bullets.init(m_config->maxBulletCount) == false) {
     return false;
   }
 
-  s_bulletMaxYPos =
-      SDLProgram::instance()->height() - m_bulletTexture->header()->height;
-
-  s_playerMaxXPos =
-      SDLProgram::instance()->width() - m_planeTexture->header()->width;
-
-  // 임시로 총알 갯수 제한
-  m_bulletCount = s_maximumBulletCount;
-  m_bullets = new Bullet[m_bulletCount];
-
   return true;
 }
 
@@ -113,52 +88,44 @@ void Player::updatePosition(float x, float y) {
       x + m_planeTexture->header()->width / 2,
       y + m_planeTexture->header()->height / 2,
   };
-  setCollider(colliderPos.x, colliderPos.y, s_playerColliderRadius);
-
-  // 충돌체 원형 좌표 수정
-  Math::createCirclePoints(m_debugColliderPoints, colliderPos.x, colliderPos.y,
-                           s_playerColliderRadius);
+  setCollider(colliderPos.x, colliderPos.y, m_colliderRadius);
 }
 
-void Player::fire()
-{
-  // std::cout << "Player::updateState fire weapon! " << m_elapsedFireTime <<
-  // std::endl ;
-  for (unsigned i = 0; i < m_bulletCount; ++i)
-  {
-    Bullet *b = &m_bullets[i];
-    if (b->state() == BulletStateIdle)
-    {
-      Vector2 pos = {m_position.x + (m_planeTexture->header()->width / 2),
-                     m_position.y - 5.0f};
-      b->position(pos);
-      b->isVisible(true);
-      pos = {b->position().x + b->size().x / 2,
-             b->position().y + b->size().y / 2};
-      b->setCollider(pos.x, pos.y, s_bulletColliderRadius);
-      b->state(BulletStateFired);
-      b->destination({pos.x, -10.0f});
-      Math::createCirclePoints(b->debugPoints(), pos.x, pos.y,
-                               s_bulletColliderRadius);
-
-      m_fired.push_back(b);
-      break;
-    }
+void Player::fire() {
+  // 빈 슬롯은 풀의 프리 리스트에서 바로 꺼냄
+  Bullet* b = m_bullets.acquire();
+  if (b == nullptr) {
+    return;
   }
+
+  Vector2 pos = {m_position.x + (m_planeTexture->header()->width / 2),
+                 m_position.y - 5.0f};
+  b->position(pos);
+  b->storePreviousPosition();
+  b->isVisible(true);
+  b->speed(m_config->bulletSpeed);
+  pos = {b->position().x + b->size().x / 2,
+         b->position().y + b->size().y / 2};
+  b->setCollider(pos.x, pos.y, s_bulletColliderRadius);
+  b->state(BulletStateFired);
+  b->destination({pos.x, -10.0f});
 }
 
 /// @brief 델타 타임을 기반으로 상태 업데이트
 /// @param delta
 void Player::updateState(double delta) {
+  // 렌더링 보간을 위해 이번 틱 시작 위치 기록
+  storePreviousPosition();
+
   // 위치 이동
   if (m_directionToMoveThisFrame) {
-    m_position.x += s_playerSpeed * delta * m_directionToMoveThisFrame;
+    m_position.x += m_config->playerSpeed * delta * m_directionToMoveThisFrame;
     updatePosition(m_position.x, m_position.y);
   }
   
   // 총알 발사
   m_elapsedFireTime += delta;
-  if (m_elapsedFireTime >= s_playerFireDelay) {
+  if (m_elapsedFireTime >= m_config->playerFireDelay) {
     fire();
     m_elapsedFireTime = 0.0f;
   }
@@ -173,68 +140,75 @@ void Player::move(int direction) {
 
 #if 0
   const float gap = 10.0f;
-  if (m_position.x <= gap || m_position.x >= (s_playerMaxXPos - gap)) {
+  if (m_position.x <= gap || m_position.x >= (m_maxXPos - gap)) {
     m_directionToMoveThisFrame = 0;
     return;
   }
 #endif
 
   m_directionToMoveThisFrame = direction;
-
-  //std::cout << "Player::move called " << m_position.x << " > " << m_destPos.x
-  //          << std::endl;
 }
 
 void Player::updateBullets(double delta) {
-  if (m_bulletTexture == nullptr || m_bullets == nullptr) {
+  if (m_bulletTexture == nullptr) {
     return;
   }
-  const float deltaSeconds = delta / 1000.0f;
-  std::vector<Bullet*>::iterator bulletIter = m_fired.begin();
-  while(bulletIter != m_fired.end()) {
-    Bullet* bullet = (*bulletIter);
+  // 도착한 총알은 풀에 돌려주므로 역순으로 순회
+  for (unsigned i = m_bullets.liveCount(); i-- > 0;) {
+    Bullet* bullet = &m_bullets.live(i);
+    bullet->storePreviousPosition();
     float movement = bullet->speed() * delta;
     float newYPos = bullet->position().y - movement;
-    
+
     if(newYPos <= bullet->destination().y) {
       // 도착
       bullet->isVisible(false);
       bullet->state(BulletStateIdle);
-      bulletIter = m_fired.erase(bulletIter);
+      m_bullets.releaseLive(i);
     } else {
       // 이동
-      bullet->position({bullet->position().x, bullet->position().y - movement});
+      bullet->position({bullet->position().x, newYPos});
 
       Vector2 newColliderPos = {
         bullet->position().x + bullet->size().x / 2, 
         bullet->position().y + bullet->size().y / 2
       };
       bullet->setCollider(newColliderPos.x, newColliderPos.y, s_bulletColliderRadius);
-
-      for (unsigned i = 0; i < 180; ++i) {
-        bullet->debugPoints()[i].y -= movement;
-      }
-      ++bulletIter;
     }
   }
 }
 
-void Player::onCollided(const GameObject& target) {
-  // TODO: 맞았음을 가시적으로 보여줘야 함
-  // std::cout << "Player::onCollided with enemy! \n";
+size_t Player::snapshotCapacity() const {
+  return sizeof(m_position) + sizeof(m_previousPosition) + sizeof(m_size) +
+         sizeof(m_tag) + sizeof(m_isVisible) + sizeof(m_hasCollider) +
+         sizeof(m_collider) + sizeof(m_directionToMoveThisFrame) +
+         sizeof(m_elapsedFireTime) + m_bullets.snapshotCapacity();
 }
 
-Vector2 Player::getColliderCenterByDelta(double delta) const {
-  float magnitude = s_playerSpeed * delta;
-  Vector2 pos = {m_collider->position.x + magnitude, m_collider->position.y};
+void Player::save(SnapshotWriter& writer) const {
+  writer.write(m_position);
+  writer.write(m_previousPosition);
+  writer.write(m_size);
+  writer.write(m_tag);
+  writer.write(m_isVisible);
+  writer.write(m_hasCollider);
+  writer.write(m_collider);
+  writer.write(m_directionToMoveThisFrame);
+  writer.write(m_elapsedFireTime);
+  m_bullets.save(writer);
+}
 
-  // 목적지에 도착을 했으면 목적지 위치의 충돌체 중심 좌표를 반환
-  if ((m_destPos - pos).magnitude() <= magnitude) {
-    return {m_destPos.x + m_planeTexture->header()->width / 2,
-            m_destPos.y + m_planeTexture->header()->height / 2};
-  } else {
-    return pos;
-  }
+void Player::restore(SnapshotReader& reader) {
+  reader.read(&m_position);
+  reader.read(&m_previousPosition);
+  reader.read(&m_size);
+  reader.read(&m_tag);
+  reader.read(&m_isVisible);
+  reader.read(&m_hasCollider);
+  reader.read(&m_collider);
+  reader.read(&m_directionToMoveThisFrame);
+  reader.read(&m_elapsedFireTime);
+  m_bullets.restore(reader);
 }
 
 }  // namespace shmup
@@ -7,14 +7,12 @@
 
 #pragma once
 
-#include <SDL.h>
-
+#include "GameConfig.hpp"
 #include "GameObject.hpp"
+#include "ObjectPool.hpp"
 #include "TGA.hpp"
 #include "Bullet.hpp"
 
-#include <vector>
-
 namespace shmup {
 
 class Player : public GameObject {
@@ -23,7 +21,9 @@ class Player : public GameObject {
 
   ~Player();
 
-  bool loadResource(SDL_Renderer* renderer);
+  /// @brief 텍스처를 읽고 설정 값으로 총알 풀 생성. config 는 Player 보다 오래 살아야 함
+  /// width 는 화면 너비로 X 이동 범위를 정함. 텍스처 업로드는 렌더러가 따로 함
+  bool loadResource(int width, const GameConfig& config);
 
   void updatePosition(float x, float y);
 
@@ -37,40 +37,38 @@ class Player : public GameObject {
 
   void updateBullets(double delta);
 
-  Bullet* bullets() { return m_bullets; }
+  /// @brief 발사된 총알만 살아있는 상태로 담고 있는 풀
+  ObjectPool<Bullet>& bullets() { return m_bullets; }
+
+  const ObjectPool<Bullet>& bullets() const { return m_bullets; }
 
-  unsigned bulletCount() const { return m_bulletCount; }
+  /// @brief 위치, 발사 타이머와 총알 풀을 기록. 텍스처와 설정은 기록하지 않음
+  size_t snapshotCapacity() const;
 
-  const Vector2* debugColliderPoints() {
-    return m_debugColliderPoints;
-  }
+  void save(SnapshotWriter& writer) const;
 
-  void onCollided(const GameObject& target) override;
+  void restore(SnapshotReader& reader);
 
-  /// @brief 만약 움직이고 있다면 주어진 시간의 예상되는 콜라이더 중심 좌표 반환.
-  /// 만약 움직이도록 설정되지 않았거나 목적지에 위치해 있다면 현재 위치 반환.
-  Vector2 getColliderCenterByDelta(double delta) const;
 private:
   void fire();
 
  private:
+  const GameConfig* m_config = nullptr;
+
   TGA* m_planeTexture = nullptr;
 
   TGA* m_bulletTexture = nullptr;
 
   int m_directionToMoveThisFrame = 0;
 
-  Vector2 m_destPos;
-
-  Bullet* m_bullets = nullptr;
+  float m_colliderRadius = 0.0f;
 
-  std::vector<Bullet*> m_fired;
+  // 화면 안에 머물 수 있는 최대 X 좌표
+  float m_maxXPos = 0.0f;
 
-  unsigned m_bulletCount = 0;
+  ObjectPool<Bullet> m_bullets;
 
   double m_elapsedFireTime = 0.0f;
-
-  Vector2* m_debugColliderPoints = nullptr;
 };
 
 }  // namespace shmup
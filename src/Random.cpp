@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// File: Random.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "Random.hpp"
+
+namespace shmup {
+
+namespace {
+uint64_t splitmix64(uint64_t& x) {
+  uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+}  // namespace
+
+Random::Random() { seed(0); }
+
+Random::Random(uint64_t seed, uint64_t stream) { this->seed(seed, stream); }
+
+void Random::seed(uint64_t seed, uint64_t stream) {
+  // 스트림 번호를 섞어서 시작 위치를 분리. splitmix64 출력으로 채우므로 상태가 모두 0이 될 일은 사실상 없음
+  uint64_t x = seed ^ (stream * 0xD1B54A32D192ED03ull);
+  const uint64_t a = splitmix64(x);
+  const uint64_t b = splitmix64(x);
+  m_state[0] = (uint32_t)a;
+  m_state[1] = (uint32_t)(a >> 32);
+  m_state[2] = (uint32_t)b;
+  m_state[3] = (uint32_t)(b >> 32);
+}
+
+void Random::fill(float* out, unsigned count, float min, float max) {
+  // 상태를 지역 변수로 두고 돌면 컴파일러가 레지스터에 유지할 수 있음
+  Random local = *this;
+  const float scale = (max - min) * (1.0f / 16777216.0f);
+  for (unsigned i = 0; i < count; ++i) {
+    out[i] = min + (float)(local.next() >> 8) * scale;
+  }
+  *this = local;
+}
+
+void Random::fill(uint32_t* out, unsigned count) {
+  Random local = *this;
+  for (unsigned i = 0; i < count; ++i) {
+    out[i] = local.next();
+  }
+  *this = local;
+}
+
+}  // namespace shmup
@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+// File: Random.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace shmup {
+
+/// @brief xoshiro128** 의사 난수 생성기.
+/// 전역 상태를 쓰는 rand() 대신 매니저(또는 스레드)마다 하나씩 가짐.
+/// 같은 시드라도 스트림 번호가 다르면 서로 독립적인 수열을 만든다.
+class Random {
+ public:
+  Random();
+
+  explicit Random(uint64_t seed, uint64_t stream = 0);
+
+  /// @brief 시드와 스트림 번호로 상태 초기화 (splitmix64로 상태를 채움)
+  void seed(uint64_t seed, uint64_t stream = 0);
+
+  uint32_t next() {
+    const uint32_t result = rotl(m_state[1] * 5, 7) * 9;
+    const uint32_t t = m_state[1] << 9;
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= t;
+    m_state[3] = rotl(m_state[3], 11);
+    return result;
+  }
+
+  /// @brief [0, 1) 구간의 float. 상위 24비트만 사용
+  float nextFloat() { return (float)(next() >> 8) * (1.0f / 16777216.0f); }
+
+  /// @brief [min, max) 구간의 float
+  float range(float min, float max) { return min + (max - min) * nextFloat(); }
+
+  /// @brief [0, bound) 구간의 정수
+  uint32_t below(uint32_t bound) {
+    return (uint32_t)(((uint64_t)next() * bound) >> 32);
+  }
+
+  /// @brief [min, max) 구간의 float 를 count 개 채움. 스폰을 한번에 처리할 때 사용
+  void fill(float* out, unsigned count, float min, float max);
+
+  /// @brief 32비트 난수를 count 개 채움
+  void fill(uint32_t* out, unsigned count);
+
+ private:
+  static uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+  uint32_t m_state[4];
+};
+
+}  // namespace shmup
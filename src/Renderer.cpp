@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// File: Renderer.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "Renderer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "Blend.hpp"
+
+namespace shmup {
+
+Renderer::Renderer() {}
+
+Renderer::~Renderer() { delete[] m_screenBuffer; }
+
+bool Renderer::initScreenBuffer(int width, int height) {
+  m_screenBuffer = new RGBA[width * height];
+  if (m_screenBuffer == nullptr) {
+    std::cout << "Renderer allocate screen buffer failed \n";
+    return false;
+  }
+  m_width = width, m_height = height;
+  return true;
+}
+
+void Renderer::clearColor(RGBA color) {
+  clearColor(color, 0, m_height);
+}
+
+void Renderer::clearColor(RGBA color, int rowBegin, int rowEnd) {
+  for(int y = rowBegin; y < rowEnd; ++y) {
+    for(int x = 0; x < m_width; ++x) {
+      int offset = y * m_width + x;
+        m_screenBuffer[offset] = { color.b, color.g, color.r, color.a };
+    }
+  }
+}
+
+/*
+  (-----width-----)
+  +---------------+^
+  |               | h
+  |   x,y ---+    | i
+  |   |      |    | g
+  |   +------+ w  | h
+  |   h           | t
+  +---------------+
+*/
+void Renderer::renderPixels(const RGBA* src, const FRect& rect) {
+  renderPixels(src, rect, 0, m_height);
+}
+
+void Renderer::renderPixels(const RGBA* src, const FRect& rect, int rowBegin,
+                            int rowEnd) {
+  if(m_screenBuffer == nullptr) return;
+
+  const int stride = m_width;
+  const int maxOffset = stride * m_height - 1;
+
+  // 화면 좌우를 벗어난 픽셀이 반대편 줄로 넘어가지 않도록 열 범위를 먼저 잘라냄.
+  // 너비가 소수이면 열 수는 올림
+  const int columns = (int)std::ceil(rect.w);
+  const int xBegin = std::max(0, -(int)rect.x);
+  const int xEnd = std::min(columns, m_width - (int)rect.x);
+  if (xBegin >= xEnd) return;
+
+  const int dstStart = (int)rect.y * stride + (int)rect.x;
+
+  for (int y = 0; y < rect.h; ++y) {
+    // 맡은 띠 밖의 줄은 건너뜀
+    const int dstY = (int)rect.y + y;
+    if (dstY < rowBegin) { continue; }
+    if (dstY >= rowEnd) { break; }
+
+    const int dstOffset = dstStart + y * stride + xBegin;
+    if (dstOffset < 0 || dstOffset + (xEnd - xBegin) - 1 > maxOffset) { break; }
+
+    // 소스 줄의 시작은 y * rect.w 를 내림한 위치
+    const RGBA* srcRow = src + (int)(y * rect.w);
+    Blend::alphaSpan(srcRow + xBegin, m_screenBuffer + dstOffset,
+                     (unsigned)(xEnd - xBegin));
+  }
+}
+
+}  // namespace shmup
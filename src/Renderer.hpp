@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// File: Renderer.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include "RGBA.hpp"
+
+namespace shmup {
+
+/// @brief 화면 좌표의 사각형. SDL_FRect 와 같은 배치
+struct FRect {
+  float x;
+  float y;
+  float w;
+  float h;
+};
+
+/// @brief 소프트웨어 합성기와 그 결과를 내보내는 백엔드의 공통 부분.
+///
+/// 화면 버퍼(BGRA, 한 줄이 width 픽셀)에 배경과 스프라이트를 CPU 로 합성하고,
+/// 합성이 끝난 버퍼를 어디로 보낼지는 백엔드가 정한다.
+///  - SDLRenderer: 스트리밍 텍스처로 올려서 창에 표시
+///  - OffscreenRenderer: 표시하지 않고 필요하면 파일로 저장 (헤드리스)
+class Renderer {
+ public:
+  Renderer();
+
+  virtual ~Renderer();
+
+  Renderer(const Renderer&) = delete;
+  Renderer& operator=(const Renderer&) = delete;
+
+  int width() const { return m_width; }
+
+  int height() const { return m_height; }
+
+  RGBA* screenBuffer() { return m_screenBuffer; }
+
+  const RGBA* screenBuffer() const { return m_screenBuffer; }
+
+  void clearColor(RGBA color);
+
+  /// @brief [rowBegin, rowEnd) 줄만 채움. 화면을 가로 띠로 나눠 병렬로 그릴 때 사용
+  void clearColor(RGBA color, int rowBegin, int rowEnd);
+
+  void renderPixels(const RGBA* src, const FRect& rect);
+
+  /// @brief [rowBegin, rowEnd) 줄에 걸친 부분만 그림
+  void renderPixels(const RGBA* src, const FRect& rect, int rowBegin,
+                    int rowEnd);
+
+  /// @brief 합성이 끝난 화면 버퍼를 내보냄. 프레임마다 한번 호출
+  virtual void presentScreenBuffer() = 0;
+
+ protected:
+  /// @brief 화면 버퍼 할당. 백엔드의 init 에서 호출
+  bool initScreenBuffer(int width, int height);
+
+ private:
+  RGBA* m_screenBuffer = nullptr;
+
+  int m_width = 0;
+
+  int m_height = 0;
+};
+
+}  // namespace shmup
@@ -22,7 +22,8 @@ SDLProgram* SDLProgram::instance() {
 
 SDLProgram::~SDLProgram() { quit(); }
 
-bool SDLProgram::init(int x, int y, int width, int height) {
+bool SDLProgram::init(int x, int y, int width, int height, bool vsync,
+                      bool headless) {
   m_width = width;
   m_height = height;
 
@@ -31,6 +32,10 @@ bool SDLProgram::init(int x, int y, int width, int height) {
     return false;
   }
 
+  if (headless) {
+    return true;
+  }
+
   m_window = SDL_CreateWindow("SDL-Examples", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, width, height,
                               SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE);
   if (m_window == nullptr) {
@@ -43,7 +48,7 @@ bool SDLProgram::init(int x, int y, int width, int height) {
   }
 
   m_renderer = new SDLRenderer();
-  if(m_renderer->init(m_window, m_width, m_height) == false) {
+  if(m_renderer->init(m_window, m_width, m_height, vsync) == false) {
     return false;
   }
 
@@ -54,8 +59,12 @@ void SDLProgram::quit() {
   m_neededQuit = true;
 
   delete m_renderer;
+  m_renderer = nullptr;
 
-  SDL_DestroyWindow(m_window);
+  if (m_window) {
+    SDL_DestroyWindow(m_window);
+    m_window = nullptr;
+  }
 
   SDL_Quit();
 }
@@ -64,7 +73,9 @@ SDL_Window* SDLProgram::window() {
   return m_window;
 }
 
-SDL_Renderer* SDLProgram::nativeRenderer() { return m_renderer->native(); }
+SDL_Renderer* SDLProgram::nativeRenderer() {
+  return m_renderer ? m_renderer->native() : nullptr;
+}
 
 SDLRenderer& SDLProgram::renderer() {
   return *m_renderer;
@@ -94,4 +105,8 @@ double SDLProgram::delta() const {
   return m_delta;
 }
 
+uint64_t SDLProgram::currentTime() const {
+  return m_currentTime;
+}
+
 }  // namespace shmup
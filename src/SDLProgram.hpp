@@ -19,7 +19,10 @@ class SDLProgram {
 
   ~SDLProgram();
 
-  bool init(int x, int y, int width, int height);
+  /// @brief headless 이면 창과 렌더러 없이 이벤트와 타이머만 초기화.
+  /// 이때 renderer() 는 사용할 수 없고 nativeRenderer() 는 nullptr
+  bool init(int x, int y, int width, int height, bool vsync = false,
+            bool headless = false);
 
   void quit();
 
@@ -39,6 +42,9 @@ class SDLProgram {
 
   double delta() const;
 
+  /// @brief 마지막 updateTime 의 퍼포먼스 카운터 값
+  uint64_t currentTime() const;
+
 private:
   SDLProgram() = default;
 
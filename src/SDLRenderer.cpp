@@ -7,7 +7,6 @@
 
 #include "SDLRenderer.hpp"
 
-#include <algorithm>
 #include <iostream>  // ste::cout long
 
 #include "Blend.hpp"
@@ -15,21 +14,25 @@
 
 namespace shmup {
 
-namespace {
-  int width = 0, height = 0;
-
-  int stride = 0;
-  int maxOffset = 0;
-}
-
 SDLRenderer::SDLRenderer() {}
 
-SDLRenderer::~SDLRenderer() { SDL_DestroyRenderer(m_renderer); }
+SDLRenderer::~SDLRenderer() {
+  for (unsigned i = 0; i < m_textureCount; ++i) {
+    SDL_DestroyTexture(m_textures[i]);
+  }
+  SDL_DestroyTexture(m_frameTexture);
+  SDL_DestroyRenderer(m_renderer);
+  delete[] m_pixelBuffer;
+}
 
 SDL_Renderer* SDLRenderer::native() { return m_renderer; }
 
-bool SDLRenderer::init(SDL_Window* window, int w, int h) {
-  m_renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+bool SDLRenderer::init(SDL_Window* window, int w, int h, bool vsync) {
+  Uint32 flags = SDL_RENDERER_ACCELERATED;
+  if (vsync) {
+    flags |= SDL_RENDERER_PRESENTVSYNC;
+  }
+  m_renderer = SDL_CreateRenderer(window, -1, flags);
   if (m_renderer == nullptr) {
     std::cout << "SDL_CreateRenderer failed error: " << SDL_GetError() << std::endl;
     return false;
@@ -42,12 +45,7 @@ bool SDLRenderer::init(SDL_Window* window, int w, int h) {
     return false;
   }
 
-  width = w, height = h;
-  stride = width;
-  maxOffset = stride * height - 1;
-
-  m_screenBuffer = new RGBA[w * h];
-  if(m_screenBuffer == nullptr) {
+  if (initScreenBuffer(w, h) == false) {
     return false;
   }
 
@@ -67,14 +65,53 @@ void SDLRenderer::enableBlending(SDL_BlendMode blendMode) {
 
 void SDLRenderer::disableBlending() { m_currentBlendMode = SDL_BLENDMODE_NONE; }
 
+bool SDLRenderer::createTexture(const TGA& tga) {
+  if (texture(tga) != nullptr) {
+    return true;
+  }
+  if (m_textureCount == s_maxTextures) {
+    std::cout << "SDLRenderer texture table is full \n";
+    return false;
+  }
+
+  SDL_Texture* texture =
+      SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_BGRA32,
+                        SDL_TEXTUREACCESS_STATIC, tga.header()->width,
+                        tga.header()->height);
+  if (texture == nullptr) {
+    std::cout << "SDL_CreateTexture failed error: " << SDL_GetError() << std::endl;
+    return false;
+  }
+  // 디코딩한 픽셀은 항상 32비트
+  const int pitch = tga.header()->width * sizeof(RGBA);
+  if (SDL_UpdateTexture(texture, nullptr, tga.pixelData(), pitch) != 0) {
+    std::cout << "SDL_UpdateTexture failed error: " << SDL_GetError() << std::endl;
+    SDL_DestroyTexture(texture);
+    return false;
+  }
+
+  m_textureImages[m_textureCount] = &tga;
+  m_textures[m_textureCount] = texture;
+  ++m_textureCount;
+  return true;
+}
+
+SDL_Texture* SDLRenderer::texture(const TGA& tga) const {
+  for (unsigned i = 0; i < m_textureCount; ++i) {
+    if (m_textureImages[i] == &tga) {
+      return m_textures[i];
+    }
+  }
+  return nullptr;
+}
+
 void SDLRenderer::drawTGA(const TGA& tga, int x, int y) {
   SDL_Rect rect = {0};
   rect.x = x, rect.y = y, rect.w = tga.header()->width,
   rect.h = tga.header()->height;
 
   if (m_currentBlendMode == SDL_BLENDMODE_NONE) {
-    SDL_RenderCopy(m_renderer, const_cast<SDL_Texture*>(tga.sdlTexture()),
-                   nullptr, &rect);
+    SDL_RenderCopy(m_renderer, texture(tga), nullptr, &rect);
     return;
   }
 
@@ -153,46 +190,16 @@ void SDLRenderer::drawTGA(const TGA& tga, int x, int y) {
 #endif
 }
 
-void SDLRenderer::clearColor(RGBA color) {
-  for(int y = 0; y < height; ++y) {
-    for(int x = 0; x < width; ++x) {
-      int offset = y * width + x;
-        m_screenBuffer[offset] = { color.b, color.g, color.r, color.a };
-    }
-  }
-}
+void SDLRenderer::present() { SDL_RenderPresent(m_renderer); }
 
-/*
-  (-----width-----)
-  +---------------+^
-  |               | h
-  |   x,y ---+    | i
-  |   |      |    | g
-  |   +------+ w  | h
-  |   h           | t
-  +---------------+
-*/
-void SDLRenderer::renderPixels(const RGBA* src, const SDL_FRect& rect) {
-  if(m_screenBuffer == nullptr) return;
-
-  const int dstStart = (int)rect.y * stride + (int)rect.x;
-  int srcOffset = 0, dstOffset = 0;
-
-  for (int y = 0; y < rect.h; ++y) {
-    for (int x = 0; x < rect.w; ++x) {
-      srcOffset = y * rect.w + x;
-      dstOffset = dstStart + (y * stride + x);
-
-      if(dstOffset < 0 || dstOffset > maxOffset) { break; }
-
-      RGBA& dest = m_screenBuffer[dstOffset];
-      dest = Blend::alpha(src[srcOffset], dest);
-    }
-  }
+void SDLRenderer::presentScreenBuffer() {
+  SDL_RenderClear(m_renderer);
+  SDL_UpdateTexture(m_frameTexture, nullptr, screenBuffer(),
+                    width() * sizeof(RGBA));
+  SDL_RenderCopy(m_renderer, m_frameTexture, nullptr, nullptr);
+  SDL_RenderPresent(m_renderer);
 }
 
-void SDLRenderer::present() { SDL_RenderPresent(m_renderer); }
-
 void SDLRenderer::flush() { SDL_RenderFlush(m_renderer); }
 
 }  // namespace shmup
@@ -12,15 +12,17 @@
 
 #include "Player.hpp"
 #include "RGBA.hpp"
+#include "Renderer.hpp"
 #include "StarManager.hpp"
 #include "TGA.hpp"
 
 namespace shmup {
 
-class SDLRenderer {
+/// @brief 창에 그리는 백엔드. 합성한 화면 버퍼는 스트리밍 텍스처로 올려서 표시
+class SDLRenderer : public Renderer {
  public:
   SDLRenderer();
-  ~SDLRenderer();
+  ~SDLRenderer() override;
 
   SDLRenderer(const SDLRenderer&) = delete;
   SDLRenderer& operator=(const SDLRenderer&) = delete;
@@ -28,17 +30,20 @@ class SDLRenderer {
   SDLRenderer(SDLRenderer&&) = delete;
   SDLRenderer& operator=(SDLRenderer&&) = delete;
 
-  bool init(SDL_Window* window, int x, int y);
+  /// @brief vsync가 true이면 present()가 디스플레이 주사율에 맞춰 대기
+  bool init(SDL_Window* window, int x, int y, bool vsync = false);
 
   SDL_Renderer* native();
 
   void clear();
 
-  void drawTGA(const TGA& tga, int x, int y);
+  /// @brief 이미지를 정적 텍스처로 올림. 이미 올린 이미지면 아무것도 하지 않음
+  bool createTexture(const TGA& tga);
 
-  void clearColor(RGBA color);
+  /// @brief createTexture 로 올린 이미지의 텍스처. 없으면 nullptr
+  SDL_Texture* texture(const TGA& tga) const;
 
-  void renderPixels(const RGBA* src, const SDL_FRect& rect);
+  void drawTGA(const TGA& tga, int x, int y);
 
   void enableBlending(SDL_BlendMode blendMode);
 
@@ -46,11 +51,10 @@ class SDLRenderer {
 
   void present();
 
-  void flush();
+  /// @brief 화면 버퍼를 텍스처로 올려서 창 전체에 복사한 뒤 표시
+  void presentScreenBuffer() override;
 
-  RGBA* m_screenBuffer = nullptr;
-  
-  SDL_Texture* m_frameTexture = nullptr;
+  void flush();
 
   SDL_BlendMode m_currentBlendMode = SDL_BLENDMODE_NONE;
 
@@ -59,6 +63,17 @@ class SDLRenderer {
 
   RGBA* m_pixelBuffer = nullptr;
 
+  SDL_Texture* m_frameTexture = nullptr;
+
+  // 게임이 쓰는 이미지 수보다 넉넉하면 됨
+  static constexpr unsigned s_maxTextures = 16;
+
+  const TGA* m_textureImages[s_maxTextures] = {};
+
+  SDL_Texture* m_textures[s_maxTextures] = {};
+
+  unsigned m_textureCount = 0;
+
 };
 
 }  // namespace shmup
@@ -0,0 +1,136 @@
+//------------------------------------------------------------------------------
+// File: Simd.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+// 4개 float를 한번에 처리하는 최소한의 SIMD 래퍼.
+// x86은 SSE, ARM은 NEON을 사용하고 둘 다 없으면 스칼라로 동작한다.
+// 배열 로드/스토어는 정렬을 요구하지 않음.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SHMUP_SIMD_SSE 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SHMUP_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define SHMUP_SIMD_SCALAR 1
+#endif
+
+namespace shmup {
+namespace simd {
+
+/// 한번에 처리하는 float 개수
+constexpr unsigned s_width = 4;
+
+#if SHMUP_SIMD_SSE
+
+struct float4 {
+  __m128 v;
+};
+
+inline float4 load(const float* p) { return {_mm_loadu_ps(p)}; }
+inline void store(float* p, float4 a) { _mm_storeu_ps(p, a.v); }
+inline float4 set1(float x) { return {_mm_set1_ps(x)}; }
+inline float4 add(float4 a, float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline float4 sub(float4 a, float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline float4 mul(float4 a, float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+/// @brief a * b + c
+inline float4 madd(float4 a, float4 b, float4 c) {
+  return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};
+}
+/// @brief 한 레인이라도 [lo, hi] 구간을 벗어나면 true
+inline bool anyOutside(float4 x, float4 lo, float4 hi) {
+  const __m128 out = _mm_or_ps(_mm_cmplt_ps(x.v, lo.v), _mm_cmpgt_ps(x.v, hi.v));
+  return _mm_movemask_ps(out) != 0;
+}
+/// @brief 한 레인이라도 a < b 이면 true
+inline bool anyLess(float4 a, float4 b) {
+  return _mm_movemask_ps(_mm_cmplt_ps(a.v, b.v)) != 0;
+}
+/// @brief x >= threshold 인 레인만 amount 를 뺌 (좌표 되감기에 사용)
+inline float4 subWhereGreaterEqual(float4 x, float4 threshold, float4 amount) {
+  const __m128 mask = _mm_cmpge_ps(x.v, threshold.v);
+  return {_mm_sub_ps(x.v, _mm_and_ps(mask, amount.v))};
+}
+
+#elif SHMUP_SIMD_NEON
+
+struct float4 {
+  float32x4_t v;
+};
+
+inline float4 load(const float* p) { return {vld1q_f32(p)}; }
+inline void store(float* p, float4 a) { vst1q_f32(p, a.v); }
+inline float4 set1(float x) { return {vdupq_n_f32(x)}; }
+inline float4 add(float4 a, float4 b) { return {vaddq_f32(a.v, b.v)}; }
+inline float4 sub(float4 a, float4 b) { return {vsubq_f32(a.v, b.v)}; }
+inline float4 mul(float4 a, float4 b) { return {vmulq_f32(a.v, b.v)}; }
+inline float4 madd(float4 a, float4 b, float4 c) {
+  return {vmlaq_f32(c.v, a.v, b.v)};
+}
+inline bool anyOutside(float4 x, float4 lo, float4 hi) {
+  const uint32x4_t out = vorrq_u32(vcltq_f32(x.v, lo.v), vcgtq_f32(x.v, hi.v));
+  const uint32x2_t half = vorr_u32(vget_low_u32(out), vget_high_u32(out));
+  return (vget_lane_u32(half, 0) | vget_lane_u32(half, 1)) != 0;
+}
+inline bool anyLess(float4 a, float4 b) {
+  const uint32x4_t less = vcltq_f32(a.v, b.v);
+  const uint32x2_t half = vorr_u32(vget_low_u32(less), vget_high_u32(less));
+  return (vget_lane_u32(half, 0) | vget_lane_u32(half, 1)) != 0;
+}
+inline float4 subWhereGreaterEqual(float4 x, float4 threshold, float4 amount) {
+  const uint32x4_t mask = vcgeq_f32(x.v, threshold.v);
+  const float32x4_t masked =
+      vreinterpretq_f32_u32(vandq_u32(mask, vreinterpretq_u32_f32(amount.v)));
+  return {vsubq_f32(x.v, masked)};
+}
+
+#else
+
+struct float4 {
+  float v[4];
+};
+
+inline float4 load(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+inline void store(float* p, float4 a) {
+  p[0] = a.v[0], p[1] = a.v[1], p[2] = a.v[2], p[3] = a.v[3];
+}
+inline float4 set1(float x) { return {{x, x, x, x}}; }
+inline float4 add(float4 a, float4 b) {
+  return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+}
+inline float4 sub(float4 a, float4 b) {
+  return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+}
+inline float4 mul(float4 a, float4 b) {
+  return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+}
+inline float4 madd(float4 a, float4 b, float4 c) { return add(mul(a, b), c); }
+inline bool anyOutside(float4 x, float4 lo, float4 hi) {
+  for (int i = 0; i < 4; ++i) {
+    if (x.v[i] < lo.v[i] || x.v[i] > hi.v[i]) return true;
+  }
+  return false;
+}
+inline bool anyLess(float4 a, float4 b) {
+  for (int i = 0; i < 4; ++i) {
+    if (a.v[i] < b.v[i]) return true;
+  }
+  return false;
+}
+inline float4 subWhereGreaterEqual(float4 x, float4 threshold, float4 amount) {
+  float4 result = x;
+  for (int i = 0; i < 4; ++i) {
+    if (x.v[i] >= threshold.v[i]) result.v[i] -= amount.v[i];
+  }
+  return result;
+}
+
+#endif
+
+}  // namespace simd
+}  // namespace shmup
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// File: Snapshot.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace shmup {
+
+/// @brief 스냅샷 버퍼에 값을 순서대로 memcpy 하는 커서.
+/// 포인터는 프로세스마다 달라지므로 절대 쓰지 않고 인덱스나 값만 기록한다.
+/// 버퍼 크기는 호출한 쪽이 snapshotCapacity() 합으로 미리 맞춰야 함.
+class SnapshotWriter {
+ public:
+  explicit SnapshotWriter(uint8_t* buffer) : m_cursor(buffer), m_begin(buffer) {}
+
+  template <typename T>
+  void write(const T& value) {
+    writeArray(&value, 1);
+  }
+
+  template <typename T>
+  void writeArray(const T* values, size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "snapshot values must be trivially copyable");
+    static_assert(std::is_pointer_v<T> == false,
+                  "snapshot must not contain pointers");
+    std::memcpy(m_cursor, values, sizeof(T) * count);
+    m_cursor += sizeof(T) * count;
+  }
+
+  size_t size() const { return (size_t)(m_cursor - m_begin); }
+
+ private:
+  uint8_t* m_cursor;
+
+  uint8_t* m_begin;
+};
+
+/// @brief SnapshotWriter 가 쓴 순서 그대로 값을 읽는 커서
+class SnapshotReader {
+ public:
+  explicit SnapshotReader(const uint8_t* buffer) : m_cursor(buffer) {}
+
+  template <typename T>
+  void read(T* value) {
+    readArray(value, 1);
+  }
+
+  template <typename T>
+  void readArray(T* values, size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "snapshot values must be trivially copyable");
+    std::memcpy(values, m_cursor, sizeof(T) * count);
+    m_cursor += sizeof(T) * count;
+  }
+
+ private:
+  const uint8_t* m_cursor;
+};
+
+}  // namespace shmup
@@ -0,0 +1,174 @@
+//------------------------------------------------------------------------------
+// File: StarField.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "StarField.hpp"
+
+#include <iostream>
+
+#include "Random.hpp"
+#include "Simd.hpp"
+#include "Snapshot.hpp"
+
+namespace shmup {
+
+namespace {
+// 같은 시드에서도 다른 매니저와 겹치지 않는 난수 스트림 번호
+constexpr uint64_t s_starFieldRandomStream = 3;
+
+// 레이어 설정: 전체 별 중 비율, 속도, 색, 커널
+struct LayerDesc {
+  float share;
+  float speed;
+  RGBA color;
+  bool wideKernel;
+};
+
+const LayerDesc s_layerDescs[StarField::s_layerCount] = {
+    {0.6f, 0.02f, {70, 70, 90, 255}, false},     // 먼 별: 어둡고 느림
+    {0.3f, 0.05f, {140, 140, 160, 255}, false},  // 중간
+    {0.1f, 0.12f, {230, 230, 255, 255}, true},   // 가까운 별: 밝고 빠름
+};
+
+/// 채널별로 더하고 255에서 자름. 어두운 배경 위라서 알파 블렌드 대신 사용
+inline void addPixel(RGBA& dest, const RGBA& color, unsigned weight) {
+  const unsigned r = dest.r + ((color.r * weight) >> 8);
+  const unsigned g = dest.g + ((color.g * weight) >> 8);
+  const unsigned b = dest.b + ((color.b * weight) >> 8);
+  dest.r = (uint8_t)(r > 255 ? 255 : r);
+  dest.g = (uint8_t)(g > 255 ? 255 : g);
+  dest.b = (uint8_t)(b > 255 ? 255 : b);
+}
+}  // namespace
+
+StarField::StarField() {}
+
+StarField::~StarField() { delete[] m_block; }
+
+bool StarField::init(unsigned starCount, int width, int height,
+                     uint64_t seed) {
+  m_width = width;
+  m_height = height;
+  m_starCount = starCount;
+
+  // 모든 레이어의 x, y를 한 블록에 할당
+  m_block = new float[(size_t)starCount * 2];
+  if (m_block == nullptr) {
+    std::cout << "StarField allocate stars failed \n";
+    return false;
+  }
+
+  Random random(seed, s_starFieldRandomStream);
+  float* cursor = m_block;
+  unsigned assigned = 0;
+  for (unsigned i = 0; i < s_layerCount; ++i) {
+    const LayerDesc& desc = s_layerDescs[i];
+    Layer& layer = m_layers[i];
+    layer.count = (i + 1 == s_layerCount)
+                      ? starCount - assigned
+                      : (unsigned)(starCount * desc.share);
+    assigned += layer.count;
+    layer.speed = desc.speed;
+    layer.color = desc.color;
+    layer.wideKernel = desc.wideKernel;
+
+    layer.x = cursor;
+    layer.y = cursor + layer.count;
+    cursor += layer.count * 2;
+
+    random.fill(layer.x, layer.count, 0.0f, (float)width);
+    random.fill(layer.y, layer.count, 0.0f, (float)height);
+  }
+  return true;
+}
+
+void StarField::update(float delta) {
+  using namespace simd;
+
+  const float height = (float)m_height;
+  const float4 height4 = set1(height);
+  for (unsigned l = 0; l < s_layerCount; ++l) {
+    Layer& layer = m_layers[l];
+    const float step = layer.speed * delta;
+    const float4 step4 = set1(step);
+
+    // 아래로 이동하고 화면을 넘어가면 위로 되감음
+    float* y = layer.y;
+    unsigned i = 0;
+    for (; i + s_width <= layer.count; i += s_width) {
+      const float4 moved = add(load(y + i), step4);
+      store(y + i, subWhereGreaterEqual(moved, height4, height4));
+    }
+    for (; i < layer.count; ++i) {
+      y[i] += step;
+      if (y[i] >= height) y[i] -= height;
+    }
+  }
+}
+
+void StarField::plot(RGBA* buffer, int stride, float renderOffset) const {
+  plot(buffer, stride, renderOffset, 0, m_height);
+}
+
+void StarField::plot(RGBA* buffer, int stride, float renderOffset,
+                     int rowBegin, int rowEnd) const {
+  const float height = (float)m_height;
+  for (unsigned l = 0; l < s_layerCount; ++l) {
+    const Layer& layer = m_layers[l];
+    const float offset = layer.speed * renderOffset;
+    const RGBA color = layer.color;
+
+    for (unsigned i = 0; i < layer.count; ++i) {
+      float y = layer.y[i] + offset;
+      if (y < 0.0f) y += height;
+
+      const int px = (int)layer.x[i];
+      const int py = (int)y;
+      if (px < 0 || px >= m_width) {
+        continue;
+      }
+
+      RGBA* center = buffer + py * stride + px;
+      const bool centerInside = py >= rowBegin && py < rowEnd;
+      if (centerInside) {
+        addPixel(*center, color, 256);
+      }
+
+      if (layer.wideKernel) {
+        // 3x3 십자 커널: 상하좌우는 흐리게
+        constexpr unsigned edge = 96;
+        if (centerInside) {
+          if (px > 0) addPixel(center[-1], color, edge);
+          if (px + 1 < m_width) addPixel(center[1], color, edge);
+        }
+        if (py - 1 >= rowBegin && py - 1 < rowEnd) {
+          addPixel(center[-stride], color, edge);
+        }
+        if (py + 1 >= rowBegin && py + 1 < rowEnd) {
+          addPixel(center[stride], color, edge);
+        }
+      }
+    }
+  }
+}
+
+size_t StarField::snapshotCapacity() const {
+  return sizeof(float) * m_starCount;
+}
+
+void StarField::save(SnapshotWriter& writer) const {
+  for (const Layer& layer : m_layers) {
+    writer.writeArray(layer.y, layer.count);
+  }
+}
+
+void StarField::restore(SnapshotReader& reader) {
+  for (Layer& layer : m_layers) {
+    reader.readArray(layer.y, layer.count);
+  }
+}
+
+}  // namespace shmup
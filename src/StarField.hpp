@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// File: StarField.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "RGBA.hpp"
+
+namespace shmup {
+
+class SnapshotReader;
+class SnapshotWriter;
+
+/// @brief 텍스처 없이 점으로 그리는 패럴랙스 별 배경.
+/// 레이어마다 x, y 좌표를 연속된 배열로 가지고 있으며 갱신은 SIMD 한번으로 끝난다.
+/// 화면 아래로 나간 별은 위로 되감아서 재사용하므로 생성/제거가 없다.
+/// 그리기는 화면 버퍼에 작은 커널(1x1 또는 3x3)을 더해서 찍는다.
+class StarField {
+ public:
+  /// 레이어 개수 (먼 곳부터 가까운 곳 순서)
+  static constexpr unsigned s_layerCount = 3;
+
+  StarField();
+
+  ~StarField();
+
+  StarField(const StarField&) = delete;
+  StarField& operator=(const StarField&) = delete;
+
+  /// @brief starCount 개의 별을 레이어에 나눠서 임의 위치에 배치
+  bool init(unsigned starCount, int width, int height, uint64_t seed);
+
+  /// @brief 한 틱 진행 (delta: ms)
+  void update(float delta);
+
+  /// @brief 화면 버퍼에 별을 더해서 그림.
+  /// @param renderOffset 마지막 틱 이후 지난 시간(ms)에서 틱 길이를 뺀 값.
+  ///   레이어 속도가 일정하므로 이전 위치를 저장하지 않고 이 값으로 보간함
+  void plot(RGBA* buffer, int stride, float renderOffset) const;
+
+  /// @brief [rowBegin, rowEnd) 줄에 걸친 픽셀만 그림. 화면을 띠로 나눠 병렬로 그릴 때 사용
+  void plot(RGBA* buffer, int stride, float renderOffset, int rowBegin,
+            int rowEnd) const;
+
+  unsigned starCount() const { return m_starCount; }
+
+  int height() const { return m_height; }
+
+  /// @brief 레이어의 별 좌표. SDL 점 그리기처럼 버퍼를 쓰지 않는 경로에서 사용
+  unsigned layerCount(unsigned layer) const { return m_layers[layer].count; }
+
+  const float* layerX(unsigned layer) const { return m_layers[layer].x; }
+
+  const float* layerY(unsigned layer) const { return m_layers[layer].y; }
+
+  float layerSpeed(unsigned layer) const { return m_layers[layer].speed; }
+
+  RGBA layerColor(unsigned layer) const { return m_layers[layer].color; }
+
+  /// @brief 별은 y 만 움직이므로 y 좌표만 기록
+  size_t snapshotCapacity() const;
+
+  void save(SnapshotWriter& writer) const;
+
+  void restore(SnapshotReader& reader);
+
+ private:
+  struct Layer {
+    float* x;
+    float* y;
+    unsigned count;
+    float speed;       // 밀리초당 이동 거리
+    RGBA color;
+    bool wideKernel;   // true 이면 3x3 십자 커널, 아니면 1픽셀
+  };
+
+  Layer m_layers[s_layerCount] = {};
+
+  float* m_block = nullptr;
+
+  unsigned m_starCount = 0;
+
+  int m_width = 0;
+
+  int m_height = 0;
+};
+
+}  // namespace shmup
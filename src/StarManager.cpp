@@ -9,6 +9,8 @@
 
 #include <iostream>
 
+#include "Snapshot.hpp"
+
 namespace shmup {
 
 #if _WIN32
@@ -17,60 +19,61 @@ constexpr auto s_starFilepath = "../resources/star.tga";
 constexpr auto s_starFilepath = "../../resources/star.tga";
 #endif
 
-float s_starMaxXPos = 0.0f;
-float s_starMaxYPos = 0.0f;
+// 같은 시드에서도 다른 매니저와 겹치지 않는 난수 스트림 번호
+constexpr uint64_t s_starRandomStream = 1;
 
-StarManager::StarManager() {
-    m_starSpawnDelay = 10.0f;
-}
+StarManager::StarManager() {}
 
 StarManager::~StarManager() {
   if (m_tga) {
     delete m_tga;
   }
-  if (m_stars) {
-    delete[] m_stars;
-  }
 }
 
-bool StarManager::init(SDL_Renderer* renderer, int width, int height,
-                       unsigned starCount) {
+bool StarManager::init(Registry* registry, int width, int height,
+                       const GameConfig& config, uint64_t seed) {
+  m_starSpawnDelay = config.starSpawnDelay;
+  m_random.seed(seed, s_starRandomStream);
+
   m_tga = new TGA();
   if (m_tga->readFromFile(s_starFilepath) == false) {
     std::cout << "StarManager read texture failed \n";
     return false;
   }
 
-  if (m_tga->createTexture(renderer) == false) {
-    std::cout << "StarManager create texture failed \n";
-    return false;
-  }
-  s_starMaxXPos = width - m_tga->header()->width;
-  s_starMaxYPos = height - m_tga->header()->height;
+  m_maxXPos = width - m_tga->header()->width;
+  m_maxYPos = height - m_tga->header()->height;
 
-  // 스타 생성
-  m_starCount = starCount;
-  m_stars = new Star[m_starCount];
+  // 스타 아키타입 생성
+  m_registry = registry;
+  m_stars = m_registry->createArchetype(s_starComponents, config.maxStarCount);
   if (m_stars == nullptr) {
-    std::cout << "StarManager create star array failed \n";
+    std::cout << "StarManager create star archetype failed \n";
     return false;
   }
+  m_sprite = m_registry->addSprite(m_tga);
   return true;
 }
 
-void StarManager::setStarRandomPos(Star* star) {
-  Vector2 value = {
-      (float)(1 * rand() / ((RAND_MAX + 1u) / m_tga->header()->width)),
-      (float)(1 * rand() / ((RAND_MAX + 1u) / m_tga->header()->height))};
-  star->size(value);
+void StarManager::spawnStar() {
+  unsigned row = 0;
+  if (m_registry->create(m_stars, &row).index == InvalidEntity.index) {
+    return;
+  }
+
+  m_stars->sizes[row] = {
+      m_random.range(0.0f, (float)m_tga->header()->width),
+      m_random.range(0.0f, (float)m_tga->header()->height)};
 
-  value = {
-      (float)(rand() / ((RAND_MAX + 1u) / s_starMaxXPos)),  // 0.0f ~ s_starMaxXPos
-      (float)(-100.0f + rand() / ((RAND_MAX + 1u))),  // -100.0f ~ 0.0
+  m_stars->positions[row] = {
+      m_random.range(0.0f, m_maxXPos),  // 0.0f ~ m_maxXPos
+      m_random.range(-100.0f, 0.0f),        // -100.0f ~ 0.0
   };
-  star->position(value);
+  m_stars->previousPositions[row] = m_stars->positions[row];
 
-  star->speed = (float)(1.0f + rand() / ((RAND_MAX + 1u) / 2));  // 1.0f ~ 3.0f
+  // 별은 위에서 아래로만 이동
+  m_stars->velocities[row] = {0.0f, m_random.range(1.0f, 3.0f)};  // 1.0f ~ 3.0f
+  m_stars->sprites[row] = m_sprite;
 }
 
 void StarManager::updateState(float delta) {
@@ -79,38 +82,33 @@ void StarManager::updateState(float delta) {
   // 정해진 시간이 지나면 스타 연출 시작
   m_lastStarSpawnTime += delta;
   if (m_lastStarSpawnTime >= m_starSpawnDelay) {
-    for (unsigned i = 0; i < m_starCount; ++i) {
-      Star* star = &m_stars[i];
-      if (star->isVisible() == false) {
-        star->isVisible(true);
-        setStarRandomPos(star);
-        break;
-      }
-    }
+    spawnStar();
     m_lastStarSpawnTime = 0.0f;
   }
 
-  // 스타 연출 업데이트
-  for (unsigned i = 0; i < m_starCount; ++i) {
-    Star* star = &m_stars[i];
-    if (star->isVisible() == true) {
-      float newYPos = star->position().y + star->speed * delta;
-
-      // 목표한 지점에 도달하면 보이지 않도록
-      if (newYPos > s_starMaxYPos) {
-        star->isVisible(false);
-      } else {
-        star->isVisible(true);
-        star->position({star->position().x, newYPos});
-      }
-    }
-  }
+  // 이동은 이동 시스템(integrateMotion)이 컬럼 단위로 처리하므로
+  // 여기서는 목표한 지점에 도달한 별만 제거
+  destroyBeyondY(*m_registry, m_stars, m_maxYPos);
 }
 
 const TGA& StarManager::tga() { return *m_tga; }
 
-const Star* StarManager::stars() { return m_stars; }
+const Archetype& StarManager::stars() const { return *m_stars; }
+
+unsigned StarManager::starCount() const { return m_stars->count; }
+
+size_t StarManager::snapshotCapacity() const {
+  return sizeof(m_random) + sizeof(m_lastStarSpawnTime);
+}
 
-unsigned StarManager::starCount() const { return m_starCount; }
+void StarManager::save(SnapshotWriter& writer) const {
+  writer.write(m_random);
+  writer.write(m_lastStarSpawnTime);
+}
+
+void StarManager::restore(SnapshotReader& reader) {
+  reader.read(&m_random);
+  reader.read(&m_lastStarSpawnTime);
+}
 
 }  // namespace shmup
@@ -8,20 +8,18 @@
 
 #pragma once
 
-#include <SDL.h>
-
 #include <RGBA.hpp>
 
-#include "GameObject.hpp"
+#include "ECS.hpp"
+#include "GameConfig.hpp"
+#include "Random.hpp"
 #include "TGA.hpp"
 
 namespace shmup {
 
-struct Star : public GameObject {
-  float speed;
-
-  void onCollided(const GameObject&) override {};
-};
+/// 별 아키타입: 위치, 속도, 크기, 스프라이트
+constexpr ComponentMask s_starComponents =
+    ComponentPosition | ComponentVelocity | ComponentSize | ComponentSprite;
 
 class StarManager {
  public:
@@ -29,25 +27,45 @@ class StarManager {
 
   ~StarManager();
 
-  bool init(SDL_Renderer* renderer, int width, int height, unsigned starCount);
+  /// @brief 별 아키타입 용량과 스폰 간격은 config 에서 읽음.
+  /// seed 는 별 전용 난수 스트림의 시드
+  bool init(Registry* registry, int width, int height,
+            const GameConfig& config, uint64_t seed);
 
   void updateState(float delta);
 
   const TGA& tga();
 
-  const Star* stars();
+  /// @brief 살아있는 별만 [0, count) 구간에 빽빽하게 담긴 아키타입
+  const Archetype& stars() const;
 
   unsigned starCount() const;
 
+  /// @brief 난수 상태와 스폰 타이머를 기록. 별 자체는 레지스트리가 기록함
+  size_t snapshotCapacity() const;
+
+  void save(SnapshotWriter& writer) const;
+
+  void restore(SnapshotReader& reader);
+
  private:
-  void setStarRandomPos(Star* star);
+  void spawnStar();
 
  private:
   TGA* m_tga = nullptr;
 
-  Star* m_stars = nullptr;
+  Registry* m_registry = nullptr;
+
+  Archetype* m_stars = nullptr;
+
+  SpriteId m_sprite = 0;
+
+  // 별이 나타나는 최대 X 좌표와 제거되는 Y 좌표
+  float m_maxXPos = 0.0f;
+
+  float m_maxYPos = 0.0f;
 
-  unsigned m_starCount = 0;
+  Random m_random;
 
   double m_lastStarSpawnTime = 0.0f;
 
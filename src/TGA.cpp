@@ -6,21 +6,30 @@
 //------------------------------------------------------------------------------
 
 #include <cstdio>
-#include <functional>
+#include <cstring>
+#include <iostream>
 #include "TGA.hpp"
 
 namespace shmup {
 
+namespace {
+// 압축하지 않은 트루컬러 이미지
+constexpr uint8_t s_imageTypeTrueColor = 2;
+
+// RLE 로 압축한 트루컬러 이미지
+constexpr uint8_t s_imageTypeRle = 10;
+
+// RLE 패킷 하나가 나타낼 수 있는 최대 픽셀 수
+constexpr unsigned s_maxPacketPixels = 128;
+
+// image_descriptor 의 5번 비트: 1이면 위쪽 줄부터 저장됨
+constexpr uint8_t s_topLeftOrigin = 0x20;
+}
+
 TGA::TGA() {}
 
 TGA::~TGA() {
-    if(m_pixelData != nullptr) {
-        delete[] m_pixelData;
-    }
-    
-    if(m_texture != nullptr) {
-        SDL_DestroyTexture(m_texture);
-    }
+    delete[] m_pixelData;
 }
 
 const TGAHeader* TGA::header() const {
@@ -31,10 +40,6 @@ const RGBA* TGA::pixelData() const {
     return m_pixelData;
 }
 
-SDL_Texture const* TGA::sdlTexture() const {
-    return m_texture;
-}
-
 bool TGA::readFromFile(const char* filepath) {
     FILE* fp = fopen(filepath, "rb");
     if(fp == nullptr) {
@@ -42,41 +47,176 @@ bool TGA::readFromFile(const char* filepath) {
         return false;
     }
 
-    // Read header
-    size_t read = fread(&m_header, sizeof(TGAHeader), 1, fp);
-    if(read == 0) {
-        // 파일 읽기 실패
+    fseek(fp, 0, SEEK_END);
+    const long fileSize = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if(fileSize <= 0) {
+        fclose(fp);
         return false;
     }
-    
-    m_pixelData = new RGBA[m_header.width * m_header.height];
 
-    // Read pixel data
-    const size_t imageSize = m_header.width * m_header.height * (m_header.pixel_depth / 8);
-    read = fread(m_pixelData, imageSize, 1, fp);
-    if(read == 0) {
+    uint8_t* data = new uint8_t[fileSize];
+    const size_t read = fread(data, (size_t)fileSize, 1, fp);
+    fclose(fp);
+
+    const bool decoded = read == 1 && decode(data, (size_t)fileSize);
+    delete[] data;
+    return decoded;
+}
+
+bool TGA::decode(const uint8_t* data, size_t size) {
+    if(size < sizeof(TGAHeader)) {
         return false;
     }
+    memcpy(&m_header, data, sizeof(TGAHeader));
 
-    fclose(fp);
+    const unsigned bytesPerPixel = m_header.pixel_depth / 8;
+    const bool rle = m_header.image_type == s_imageTypeRle;
+    if((m_header.image_type != s_imageTypeTrueColor && rle == false) ||
+       m_header.color_map_type != 0 || (bytesPerPixel != 3 && bytesPerPixel != 4)) {
+        std::cout << "TGA unsupported image type " << (int)m_header.image_type
+                  << ", " << (int)m_header.pixel_depth << " bits \n";
+        return false;
+    }
+
+    // 헤더 뒤의 이미지 ID 는 건너뜀
+    const size_t width = m_header.width, height = m_header.height;
+    const size_t pixelOffset = sizeof(TGAHeader) + m_header.id_length;
+    const size_t rowSize = width * bytesPerPixel;
+    if(size < pixelOffset || (rle == false && size < pixelOffset + rowSize * height)) {
+        return false;
+    }
 
+    delete[] m_pixelData;
+    m_pixelData = new RGBA[width * height];
+
+    const bool topLeft = (m_header.image_descriptor & s_topLeftOrigin) != 0;
+    const uint8_t* pixels = data + pixelOffset;
+    if(rle) {
+        return decodeRle(pixels, data + size, bytesPerPixel, topLeft);
+    }
+    if(bytesPerPixel == 4 && topLeft) {
+        // 게임 리소스는 모두 이 형식이라 그대로 복사
+        memcpy(m_pixelData, pixels, rowSize * height);
+        return true;
+    }
+
+    for(size_t y = 0; y < height; ++y) {
+        const uint8_t* src = pixels + (topLeft ? y : height - 1 - y) * rowSize;
+        RGBA* dst = m_pixelData + y * width;
+        if(bytesPerPixel == 4) {
+            memcpy(dst, src, rowSize);
+            continue;
+        }
+        // 파일의 바이트 순서(BGR)를 그대로 두고 알파만 채움
+        for(size_t x = 0; x < width; ++x, src += 3) {
+            dst[x] = { src[0], src[1], src[2], 255 };
+        }
+    }
     return true;
 }
 
-bool TGA::createTexture(SDL_Renderer *renderer) {
-    m_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_BGRA32, 
-                                  SDL_TEXTUREACCESS_STATIC, m_header.width, m_header.height);
-    const int pitch = m_header.width * (m_header.pixel_depth / 8);
-    if(SDL_UpdateTexture(m_texture, nullptr, m_pixelData, pitch) != 0) {
-        SDL_assert(false);
-        return false;
+/*
+  RLE 패킷: 첫 바이트의 최상위 비트가 1 이면 다음 픽셀 하나를 (n & 0x7f) + 1 번 반복,
+  0 이면 뒤따르는 픽셀 n + 1 개를 그대로 사용. 패킷이 줄을 넘어가도 읽을 수 있음
+*/
+bool TGA::decodeRle(const uint8_t* src, const uint8_t* end,
+                    unsigned bytesPerPixel, bool topLeft) {
+    const size_t width = m_header.width, height = m_header.height;
+    size_t x = 0, y = 0;
+    RGBA* dstRow = m_pixelData + (topLeft ? 0 : height - 1) * width;
+
+    while(y < height) {
+        if(src >= end) {
+            return false;
+        }
+        const uint8_t packet = *src++;
+        const unsigned count = (packet & 0x7f) + 1;
+        const bool run = (packet & 0x80) != 0;
+        if(src + (run ? 1 : count) * bytesPerPixel > end) {
+            return false;
+        }
+
+        for(unsigned i = 0; i < count && y < height; ++i) {
+            dstRow[x] = { src[0], src[1], src[2],
+                          bytesPerPixel == 4 ? src[3] : (uint8_t)255 };
+            if(run == false) {
+                src += bytesPerPixel;
+            }
+            if(++x == width) {
+                x = 0, ++y;
+                dstRow = m_pixelData + (topLeft ? y : height - 1 - y) * width;
+            }
+        }
+        if(run) {
+            src += bytesPerPixel;
+        }
     }
-    
-    // 만약 SDL_Texture로만 렌더링한다면 메모리 해제, 그렇지 않으면 메모리를 그대로 둬도 됨
-    //delete[] m_pixel_data;
-    //m_pixel_data = nullptr;
-    
     return true;
 }
 
+bool TGA::writeToFile(const char* filepath, const RGBA* pixels,
+                      unsigned width, unsigned height, bool compress) {
+    TGAHeader header = {};
+    header.image_type = compress ? s_imageTypeRle : s_imageTypeTrueColor;
+    header.width = (uint16_t)width;
+    header.height = (uint16_t)height;
+    header.pixel_depth = 32;
+    // 알파 8비트, 위쪽 줄부터
+    header.image_descriptor = s_topLeftOrigin | 8;
+
+    FILE* fp = fopen(filepath, "wb");
+    if(fp == nullptr) {
+        std::cout << "TGA failed to open " << filepath << " for writing \n";
+        return false;
+    }
+    const size_t pixelCount = (size_t)width * height;
+    bool written = fwrite(&header, sizeof(TGAHeader), 1, fp) == 1;
+    if(compress == false) {
+        written = written && fwrite(pixels, sizeof(RGBA), pixelCount, fp) == pixelCount;
+        fclose(fp);
+        return written;
+    }
+
+    // 줄마다 따로 압축. 가장 나쁜 경우에도 픽셀 4바이트와 패킷 헤더 1바이트를 넘지 않음
+    uint8_t* packed = new uint8_t[pixelCount * (sizeof(RGBA) + 1)];
+    uint8_t* dst = packed;
+    for(unsigned y = 0; y < height; ++y) {
+        const RGBA* row = pixels + (size_t)y * width;
+        unsigned x = 0;
+        while(x < width) {
+            // 같은 픽셀이 두 번 이상 이어지면 반복 패킷
+            unsigned run = 1;
+            while(x + run < width && run < s_maxPacketPixels &&
+                  memcmp(&row[x + run], &row[x], sizeof(RGBA)) == 0) {
+                ++run;
+            }
+            if(run > 1) {
+                *dst++ = (uint8_t)(0x80 | (run - 1));
+                memcpy(dst, &row[x], sizeof(RGBA));
+                dst += sizeof(RGBA);
+                x += run;
+                continue;
+            }
+
+            // 다음 반복이 시작되기 전까지는 그대로 복사하는 패킷
+            unsigned raw = 1;
+            while(x + raw < width && raw < s_maxPacketPixels &&
+                  (x + raw + 1 >= width ||
+                   memcmp(&row[x + raw], &row[x + raw + 1], sizeof(RGBA)) != 0)) {
+                ++raw;
+            }
+            *dst++ = (uint8_t)(raw - 1);
+            memcpy(dst, &row[x], raw * sizeof(RGBA));
+            dst += raw * sizeof(RGBA);
+            x += raw;
+        }
+    }
+    const size_t packedSize = (size_t)(dst - packed);
+    written = written && fwrite(packed, 1, packedSize, fp) == packedSize;
+    delete[] packed;
+    fclose(fp);
+    return written;
+}
+
 } // namespace shmup
\ No newline at end of file
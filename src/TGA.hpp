@@ -7,8 +7,8 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <SDL.h>
 #include "RGBA.hpp"
 
 namespace shmup {
@@ -57,28 +57,43 @@ struct TGAFooter {
 };
 #pragma pack(pop)
 
+/// @brief 트루컬러 TGA 디코더/인코더. 압축하지 않은 타입 2 와 RLE 압축한 타입 10 을
+/// 읽는다. SDL 없이 픽셀만 다룬다.
+/// 24비트는 알파 255 로 채워서 32비트로 바꾸고, 아래에서 위로 저장된 이미지는 뒤집어서
+/// 항상 위쪽 줄부터 저장한다. 텍스처 업로드는 SDLRenderer 에서 함.
 class TGA {
 public:
     TGA();
 
     ~TGA();
-    
+
+    TGA(const TGA&) = delete;
+    TGA& operator=(const TGA&) = delete;
+
     const TGAHeader* header() const;
     
     const RGBA* pixelData() const;
-    
-    SDL_Texture const* sdlTexture() const;
 
+    /// @brief 파일 전체를 읽어서 decode
     bool readFromFile(const char* filepath);
-    
-    bool createTexture(SDL_Renderer* renderer);
+
+    /// @brief 메모리에 있는 TGA 파일 내용을 픽셀로 변환
+    bool decode(const uint8_t* data, size_t size);
+
+    /// @brief BGRA 픽셀을 위쪽 줄부터 저장한 32비트 TGA 파일로 씀.
+    /// compress 이면 RLE(타입 10) 로 압축. 단색 영역이 넓은 화면 캡처에 적합
+    static bool writeToFile(const char* filepath, const RGBA* pixels,
+                            unsigned width, unsigned height,
+                            bool compress = false);
 
 private:
-    TGAHeader m_header;
+    /// @brief RLE 패킷을 풀어서 m_pixelData 를 채움
+    bool decodeRle(const uint8_t* src, const uint8_t* end,
+                   unsigned bytesPerPixel, bool topLeft);
+
+    TGAHeader m_header = {};
 
     RGBA* m_pixelData = nullptr;
-    
-    SDL_Texture* m_texture = nullptr;
 };
 
 } // namespace shmup
\ No newline at end of file
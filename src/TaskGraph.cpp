@@ -0,0 +1,246 @@
+//------------------------------------------------------------------------------
+// File: TaskGraph.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "TaskGraph.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace shmup {
+
+namespace {
+uint64_t nowNs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// 모든 작업을 자식으로 두고 함께 기다리기 위한 빈 잡
+void rootJob(Job*, const void*) {}
+}  // namespace
+
+void TaskGraph::init(JobSystem* jobs, const char* name) {
+  m_jobs = jobs;
+  m_name = name;
+  m_taskCount = 0;
+  m_runCount = 0;
+  m_wallNs = m_workNs = m_criticalNs = 0;
+}
+
+bool TaskGraph::addTask(const char* name, TaskFunction function, void* context,
+                        uint32_t reads, uint32_t writes) {
+  if (m_taskCount >= s_maxTasks) {
+    std::cout << "TaskGraph " << m_name << " too many tasks \n";
+    return false;
+  }
+
+  // 자원이 겹치는 앞선 작업. 읽기끼리는 겹쳐도 됨
+  uint32_t conflicts = 0;
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    const Task& other = m_tasks[i];
+    if ((other.writes & (reads | writes)) != 0 || (other.reads & writes) != 0) {
+      conflicts |= 1u << i;
+    }
+  }
+
+  // 다른 충돌 작업을 거쳐서 이미 이어지는 작업은 직접 잇지 않음
+  uint32_t inherited = 0;
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    if (conflicts & (1u << i)) {
+      inherited |= m_tasks[i].ancestors;
+    }
+  }
+  const uint32_t dependencies = conflicts & ~inherited;
+
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    if ((dependencies & (1u << i)) &&
+        m_tasks[i].dependentCount >= Job::s_maxContinuations) {
+      std::cout << "TaskGraph " << m_name << " too many dependents on "
+                << m_tasks[i].name << " \n";
+      return false;
+    }
+  }
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    if (dependencies & (1u << i)) {
+      ++m_tasks[i].dependentCount;
+    }
+  }
+
+  Task& task = m_tasks[m_taskCount++];
+  task = {};
+  task.name = name;
+  task.function = function;
+  task.context = context;
+  task.reads = reads;
+  task.writes = writes;
+  task.dependencies = dependencies;
+  task.ancestors = conflicts | inherited;
+  return true;
+}
+
+void TaskGraph::taskJob(Job*, const void* data) {
+  TaskPayload payload;
+  std::memcpy(&payload, data, sizeof(payload));
+  Task& task = payload.graph->m_tasks[payload.index];
+  task.startNs = nowNs();
+  task.function(task.context);
+  task.endNs = nowNs();
+}
+
+void TaskGraph::run() {
+  if (m_taskCount == 0) {
+    return;
+  }
+  const uint64_t startNs = nowNs();
+
+  static_assert(sizeof(TaskPayload) <= Job::s_payloadSize,
+                "TaskGraph payload does not fit in a job");
+  Job* root = m_jobs->create(&rootJob);
+  Job* jobs[s_maxTasks];
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    const TaskPayload payload = {this, i};
+    jobs[i] = m_jobs->createChild(root, &taskJob, &payload, sizeof(payload));
+  }
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    for (unsigned d = 0; d < i; ++d) {
+      if (m_tasks[i].dependencies & (1u << d)) {
+        m_jobs->addDependency(jobs[i], jobs[d]);
+      }
+    }
+  }
+
+  // 덱은 나중에 넣은 것부터 꺼내므로 거꾸로 넣어서 한 스레드일 때 추가한 순서로 실행
+  for (unsigned i = m_taskCount; i-- > 0;) {
+    m_jobs->run(jobs[i]);
+  }
+  m_jobs->run(root);
+  m_jobs->wait(root);
+
+  // 집계
+  uint64_t durations[s_maxTasks];
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    Task& task = m_tasks[i];
+    durations[i] = task.endNs - task.startNs;
+    task.totalNs += durations[i];
+    m_workNs += durations[i];
+  }
+  unsigned path[s_maxTasks];
+  unsigned pathLength = 0;
+  m_criticalNs += criticalPath(durations, path, &pathLength);
+  for (unsigned i = 0; i < pathLength; ++i) {
+    ++m_tasks[path[i]].criticalCount;
+  }
+  m_wallNs += nowNs() - startNs;
+  ++m_runCount;
+}
+
+uint64_t TaskGraph::criticalPath(const uint64_t* durations, unsigned* path,
+                                 unsigned* pathLength) const {
+  // 작업이 없으면 경로도 없음 (아래 finish[last], previous[last] 는 작업이 하나 이상일 때만 유효)
+  if (m_taskCount == 0) {
+    *pathLength = 0;
+    return 0;
+  }
+
+  // 작업은 의존하는 작업보다 항상 뒤에 추가되므로 추가한 순서가 위상 순서
+  uint64_t finish[s_maxTasks];
+  int previous[s_maxTasks];
+  unsigned last = 0;
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    uint64_t start = 0;
+    previous[i] = -1;
+    for (unsigned d = 0; d < i; ++d) {
+      if ((m_tasks[i].dependencies & (1u << d)) && finish[d] > start) {
+        start = finish[d];
+        previous[i] = (int)d;
+      }
+    }
+    finish[i] = start + durations[i];
+    if (finish[i] > finish[last]) {
+      last = i;
+    }
+  }
+
+  unsigned length = 0;
+  for (int i = (int)last; i >= 0; i = previous[i]) {
+    path[length++] = (unsigned)i;
+  }
+  *pathLength = length;
+  return finish[last];
+}
+
+void TaskGraph::report() const {
+  if (m_runCount == 0) {
+    return;
+  }
+  const double runs = (double)m_runCount;
+  std::cout << "TaskGraph " << m_name << ": " << m_runCount
+            << " runs, wall " << m_wallNs / runs / 1000.0 << " us, work "
+            << m_workNs / runs / 1000.0 << " us, critical path "
+            << m_criticalNs / runs / 1000.0 << " us\n";
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    const Task& task = m_tasks[i];
+    std::cout << "  " << task.name << ": " << task.totalNs / runs / 1000.0
+              << " us, critical " << 100.0 * task.criticalCount / runs << "%\n";
+  }
+
+  // 평균 시간으로 다시 구한 임계 경로
+  uint64_t durations[s_maxTasks];
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    durations[i] = m_tasks[i].totalNs / m_runCount;
+  }
+  unsigned path[s_maxTasks];
+  unsigned pathLength = 0;
+  criticalPath(durations, path, &pathLength);
+  std::cout << "  critical path:";
+  for (unsigned i = pathLength; i-- > 0;) {
+    std::cout << " " << m_tasks[path[i]].name << (i > 0 ? " ->" : "\n");
+  }
+}
+
+void TaskGraph::writeJson(FILE* file) const {
+  const double runs = m_runCount ? (double)m_runCount : 1.0;
+  fprintf(file,
+          "{\"name\": \"%s\", \"runs\": %llu, \"wallUs\": %.3f, "
+          "\"workUs\": %.3f, \"criticalPathUs\": %.3f,\n \"tasks\": [\n",
+          m_name, (unsigned long long)m_runCount, m_wallNs / runs / 1000.0,
+          m_workNs / runs / 1000.0, m_criticalNs / runs / 1000.0);
+
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    const Task& task = m_tasks[i];
+    fprintf(file,
+            "  {\"name\": \"%s\", \"reads\": %u, \"writes\": %u, "
+            "\"averageUs\": %.3f, \"criticalShare\": %.4f, \"dependsOn\": [",
+            task.name, task.reads, task.writes, task.totalNs / runs / 1000.0,
+            task.criticalCount / runs);
+    bool first = true;
+    for (unsigned d = 0; d < i; ++d) {
+      if (task.dependencies & (1u << d)) {
+        fprintf(file, "%s\"%s\"", first ? "" : ", ", m_tasks[d].name);
+        first = false;
+      }
+    }
+    fprintf(file, "]}%s\n", i + 1 < m_taskCount ? "," : "");
+  }
+
+  uint64_t durations[s_maxTasks];
+  for (unsigned i = 0; i < m_taskCount; ++i) {
+    durations[i] = m_runCount ? m_tasks[i].totalNs / m_runCount : 0;
+  }
+  unsigned path[s_maxTasks];
+  unsigned pathLength = 0;
+  if (m_taskCount > 0) {
+    criticalPath(durations, path, &pathLength);
+  }
+  fprintf(file, " ],\n \"criticalPath\": [");
+  for (unsigned i = pathLength; i-- > 0;) {
+    fprintf(file, "\"%s\"%s", m_tasks[path[i]].name, i > 0 ? ", " : "");
+  }
+  fprintf(file, "]}");
+}
+
+}  // namespace shmup
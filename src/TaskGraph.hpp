@@ -0,0 +1,107 @@
+//------------------------------------------------------------------------------
+// File: TaskGraph.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+#include "JobSystem.hpp"
+
+namespace shmup {
+
+/// context 는 addTask 에 넘긴 포인터
+using TaskFunction = void (*)(void* context);
+
+/// @brief 읽고 쓰는 자원을 선언한 작업들을 JobSystem 위에서 겹칠 수 있는 만큼
+/// 겹쳐서 실행하는 그래프.
+///
+/// - 자원은 호출하는 쪽이 정한 비트 마스크. 앞서 추가한 작업이 쓰는 자원을 읽거나
+///   쓰는 작업, 앞선 작업이 읽는 자원을 쓰는 작업은 그 작업 뒤에 실행된다.
+/// - 충돌하는 작업끼리는 추가한 순서대로 실행되므로 스레드 수와 상관없이
+///   한 스레드에서 차례로 실행한 것과 결과가 같다.
+/// - 다른 경로로 이미 이어진 의존은 빼서 간선을 최소로 유지한다.
+/// - 실행할 때마다 작업별 시간을 재서 임계 경로(가장 오래 걸린 의존 사슬)를 집계한다.
+class TaskGraph {
+ public:
+  static constexpr unsigned s_maxTasks = 16;
+
+  /// @brief name 은 리포트에 쓰는 이름으로 그래프보다 오래 살아야 함
+  void init(JobSystem* jobs, const char* name);
+
+  /// @brief 작업 추가. reads/writes 는 읽고 쓰는 자원의 비트 마스크
+  /// @return 작업이 너무 많거나 의존이 잡 한도를 넘으면 false
+  bool addTask(const char* name, TaskFunction function, void* context,
+               uint32_t reads, uint32_t writes);
+
+  /// @brief 모든 작업을 한번 실행하고 끝날 때까지 기다림
+  void run();
+
+  unsigned taskCount() const { return m_taskCount; }
+
+  /// @brief 작업별 평균 시간, 임계 경로에 든 비율, 평균 임계 경로 출력
+  void report() const;
+
+  /// @brief 그래프 구조와 평균 시간, 임계 경로를 JSON 객체 하나로 씀
+  void writeJson(FILE* file) const;
+
+ private:
+  struct Task {
+    const char* name;
+    TaskFunction function;
+    void* context;
+    uint32_t reads;
+    uint32_t writes;
+
+    // 바로 앞에 실행해야 하는 작업과 모든 선행 작업의 비트 마스크
+    uint32_t dependencies;
+    uint32_t ancestors;
+
+    unsigned dependentCount;
+
+    // 마지막 실행의 시작/끝 (ns)
+    uint64_t startNs;
+    uint64_t endNs;
+
+    uint64_t totalNs;
+
+    // 임계 경로에 든 실행 횟수
+    uint64_t criticalCount;
+  };
+
+  struct TaskPayload {
+    TaskGraph* graph;
+    unsigned index;
+  };
+
+  static void taskJob(Job* job, const void* data);
+
+  /// @brief 작업별 시간(ns)으로 가장 긴 의존 사슬을 구함.
+  /// @return 사슬의 길이. path 에 끝에서부터 작업 번호를 채우고 pathLength 에 개수
+  uint64_t criticalPath(const uint64_t* durations, unsigned* path,
+                        unsigned* pathLength) const;
+
+ private:
+  JobSystem* m_jobs = nullptr;
+
+  const char* m_name = "";
+
+  Task m_tasks[s_maxTasks] = {};
+
+  unsigned m_taskCount = 0;
+
+  uint64_t m_runCount = 0;
+
+  // 실행 전체(벽시계), 작업 시간의 합, 임계 경로 길이의 누적 (ns)
+  uint64_t m_wallNs = 0;
+
+  uint64_t m_workNs = 0;
+
+  uint64_t m_criticalNs = 0;
+};
+
+}  // namespace shmup
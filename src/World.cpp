@@ -0,0 +1,238 @@
+//------------------------------------------------------------------------------
+// File: World.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "World.hpp"
+
+#include <iostream>
+
+#include "AllocationTracker.hpp"
+
+namespace shmup {
+
+namespace {
+// 적 탄막 탄 하나의 충돌 반지름
+constexpr float s_patternBulletRadius = 3.0f;
+
+// 충돌 검사에서 한 잡이 맡는 적 수
+constexpr unsigned s_collisionGrain = 64;
+
+/// @brief 충돌한 쌍. 엔티티/풀 핸들로 저장해서 검사가 끝난 뒤 한번에 처리.
+/// enemy 가 InvalidEntity 이면 충돌 없음
+struct Contact {
+  Entity enemy;
+  PoolHandle bullet;
+  bool withPlayer;
+};
+
+/// @brief 충돌 검사하면서 각 적나 총알의 상태가 변경되도록 플래그 설정
+/// 고정 틱마다 한번씩 호출되므로 오브젝트가 한 틱에 움직이는 거리는 항상 같다
+/// - 공간분할을 통해 빠르게 할 수 있음; 예시로 쿼드 트리가 있음
+/// 충돌 목록은 프레임 아레나에 만들어서 힙을 쓰지 않음
+void performCollisionChecks(Registry* registry, EnemyManager* enemyManager,
+                            Player* player, FrameArena& arena,
+                            JobSystem& jobs) {
+  const Archetype& enemies = enemyManager->enemies();
+  ObjectPool<Bullet>& bullets = player->bullets();
+  const unsigned enemyCount = enemies.count;
+  const unsigned bulletCount = bullets.liveCount();
+
+  // player <-> 적 탄막: 닿은 탄만 제거. 플레이어에게는 체력이 없으므로
+  // 적과 부딪혔을 때와 마찬가지로 플레이어 상태는 바뀌지 않음
+  if (player->isVisible()) {
+    const CircleCollider* collider = player->collider();
+    enemyManager->patterns().collide(collider->position,
+                                     collider->radius + s_patternBulletRadius);
+  }
+
+  // 적 하나당 충돌은 최대 하나. 적 순서대로 칸을 나눠 두고 병렬로 채운 뒤
+  // 순서대로 처리하므로 스레드 수와 상관없이 결과가 같음
+  Contact* contacts = arena.allocateArray<Contact>(enemyCount);
+
+  const CircleCollider* playerCollider = player->collider();
+  const bool playerVisible = player->isVisible();
+  jobs.parallelFor(0, enemyCount, s_collisionGrain,
+                   [&](unsigned begin, unsigned end) {
+    for (unsigned i = begin; i < end; ++i) {
+      contacts[i] = {InvalidEntity, {}, false};
+
+      // 적 충돌체 위치는 적 위치 기준 오프셋
+      const Vector2 enemyCenter = enemies.positions[i] + enemies.colliders[i].position;
+      const float enemyRadius = enemies.colliders[i].radius;
+
+      // player <-> enemies
+      if (playerVisible &&
+          circlesOverlap(enemyCenter, enemyRadius, playerCollider->position,
+                         playerCollider->radius)) {
+        contacts[i] = {enemies.entities[i], {}, true};
+        continue;
+      }
+
+      // Enemies <-> bullet
+      for (unsigned j = 0; j < bulletCount; ++j) {
+        const CircleCollider* bulletCollider = bullets.live(j).collider();
+        if (circlesOverlap(enemyCenter, enemyRadius, bulletCollider->position,
+                           bulletCollider->radius)) {
+          contacts[i] = {enemies.entities[i], bullets.handle(j), false};
+          break;
+        }
+      }
+    }
+  });
+
+  // 충돌 처리: 같은 총알이 여러 적과 겹쳤다면 먼저 기록된 충돌만 유효
+  for (unsigned i = 0; i < enemyCount; ++i) {
+    const Contact& contact = contacts[i];
+    if (contact.enemy.index == InvalidEntity.index ||
+        registry->isAlive(contact.enemy) == false) {
+      continue;
+    }
+
+    if (contact.withPlayer) {
+      // TODO: 적과 부딪혔을 때 플레이어 처리
+      registry->destroy(contact.enemy);
+      continue;
+    }
+
+    if (bullets.get(contact.bullet) == nullptr) {
+      continue;
+    }
+    bullets.release(contact.bullet);
+    registry->destroy(contact.enemy);
+  }
+  arena.deallocate(contacts);
+}
+
+void motionTask(void* context) {
+  World& world = *static_cast<World*>(context);
+  integrateMotion(world.registry(), (float)world.tickLength(), world.jobs());
+}
+
+void starTask(void* context) {
+  World& world = *static_cast<World*>(context);
+  world.starManager().updateState((float)world.tickLength());
+}
+
+void starFieldTask(void* context) {
+  World& world = *static_cast<World*>(context);
+  world.starField()->update((float)world.tickLength());
+}
+
+void playerTask(void* context) {
+  World& world = *static_cast<World*>(context);
+  world.player().updateState(world.tickLength());
+}
+
+void enemyTask(void* context) {
+  World& world = *static_cast<World*>(context);
+  world.enemyManager().updateState(world.tickLength(),
+                                   world.player().collider()->position);
+}
+
+void collisionTask(void* context) {
+  World& world = *static_cast<World*>(context);
+  AllocationZone collisionZone("collision");
+  performCollisionChecks(&world.registry(), &world.enemyManager(),
+                         &world.player(), world.frameArena(), *world.jobs());
+}
+}  // namespace
+
+World::World() {}
+
+World::~World() { delete m_starField; }
+
+bool World::init(const GameConfig& config, int width, int height,
+                 uint64_t seed, double tick, JobSystem* jobs) {
+  m_jobs = jobs;
+  m_tickLength = tick;
+  m_tickCount = 0;
+
+  // 엔티티 저장소: 아키타입별 컴포넌트 컬럼을 미리 할당
+  if (m_registry.init(config.maxEntityCount) == false) {
+    return false;
+  }
+
+  if (m_starManager.init(&m_registry, width, height, config,
+                         seed) == false) {
+    return false;
+  }
+
+  // 설정에 점 별 개수가 있으면 스프라이트 별 대신 패럴랙스 별 배경을 사용
+  if (config.proceduralStarCount > 0) {
+    m_starField = new StarField();
+    if (m_starField->init(config.proceduralStarCount, width, height, seed) ==
+        false) {
+      return false;
+    }
+  }
+
+  if (m_player.loadResource(width, config) == false) {
+    std::cout << "World load player failed \n";
+    return false;
+  }
+  const TGAHeader* plane = m_player.planeTexture().header();
+  m_player.updatePosition((float)(int)(width / 2 - plane->width / 2),
+                          (float)(int)(height - plane->height));
+
+  if (m_enemyManager.init(&m_registry, width, height, config, seed,
+                          tick, jobs) == false) {
+    return false;
+  }
+
+  if (m_frameArena.init(config.frameArenaSize) == false) {
+    return false;
+  }
+
+  // 첫 틱 전에 렌더링해도 이전 위치가 원점에서 보간되지 않도록 맞춤
+  m_player.storePreviousPosition();
+
+  return buildSimulationGraph();
+}
+
+void World::tick() {
+  m_simulationGraph.run();
+  ++m_tickCount;
+}
+
+size_t World::snapshotCapacity() const { return sizeof(m_tickCount); }
+
+void World::save(SnapshotWriter& writer) const { writer.write(m_tickCount); }
+
+void World::restore(SnapshotReader& reader) { reader.read(&m_tickCount); }
+
+/// 선언한 자원에서 나오는 의존은
+///
+///   motion ──> stars ──┐
+///   player ────────────┴──> enemies ──> collisions
+///   starfield
+///
+/// 별과 적은 같은 레지스트리에서 엔티티를 만들고 지우므로 차례로 실행하고,
+/// 적은 갱신된 플레이어 위치를 조준하므로 플레이어 뒤에 실행함.
+/// 점 별은 다른 상태와 겹치지 않아서 나머지와 함께 실행됨
+bool World::buildSimulationGraph() {
+  m_simulationGraph.init(m_jobs, "simulation");
+  bool added = m_simulationGraph.addTask("motion", &motionTask, this, 0,
+                                         ResourceStars | ResourceEnemies);
+  if (m_starField) {
+    added = added && m_simulationGraph.addTask("starfield", &starFieldTask,
+                                               this, 0, ResourceStarField);
+  } else {
+    added = added && m_simulationGraph.addTask("stars", &starTask, this, 0,
+                                               ResourceEntities | ResourceStars);
+  }
+  added = added && m_simulationGraph.addTask("player", &playerTask, this, 0,
+                                             ResourcePlayer | ResourceBullets);
+  added = added && m_simulationGraph.addTask(
+                       "enemies", &enemyTask, this, ResourcePlayer,
+                       ResourceEntities | ResourceEnemies | ResourcePatterns);
+  added = added && m_simulationGraph.addTask(
+                       "collisions", &collisionTask, this, ResourcePlayer,
+                       ResourceEntities | ResourceEnemies | ResourcePatterns |
+                           ResourceBullets);
+  return added;
+}
+
+}  // namespace shmup
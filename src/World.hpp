@@ -0,0 +1,118 @@
+//------------------------------------------------------------------------------
+// File: World.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "ECS.hpp"
+#include "EnemyManager.hpp"
+#include "FrameArena.hpp"
+#include "GameConfig.hpp"
+#include "JobSystem.hpp"
+#include "Player.hpp"
+#include "Snapshot.hpp"
+#include "StarField.hpp"
+#include "StarManager.hpp"
+#include "TaskGraph.hpp"
+
+namespace shmup {
+
+/// 월드 상태를 나눈 자원. TaskGraph 작업이 읽고 쓰는 것을 선언할 때 사용
+enum WorldResource : uint32_t {
+  ResourceEntities = 1u << 0,   // 레지스트리의 엔티티 슬롯 (생성/제거)
+  ResourceStars = 1u << 1,      // 스프라이트 별 아키타입 컬럼
+  ResourceStarField = 1u << 2,
+  ResourceEnemies = 1u << 3,    // 적 아키타입 컬럼
+  ResourcePatterns = 1u << 4,   // 적 탄막
+  ResourcePlayer = 1u << 5,
+  ResourceBullets = 1u << 6,    // 플레이어 총알 풀
+
+  // 월드 밖의 자원(그리기 목록 등)은 이 비트부터 사용
+  ResourceWorldEnd = 1u << 7,
+};
+
+/// @brief 게임 한 판의 모든 시뮬레이션 상태를 가진 컨텍스트.
+///
+/// 엔티티 저장소, 매니저, 플레이어, 프레임 아레나와 한 틱의 작업 그래프를 소유한다.
+/// 파일 범위의 가변 상태가 없으므로 월드마다 다른 스레드에서 동시에 진행해도 된다.
+/// SDL 을 쓰지 않으며, 화면에 그릴 때는 렌더러가 이미지(TGA)를 텍스처로 올린다.
+class World {
+ public:
+  World();
+
+  ~World();
+
+  World(const World&) = delete;
+  World& operator=(const World&) = delete;
+
+  /// @brief 모든 시스템을 초기화하고 플레이어를 화면 아래 가운데에 둠.
+  /// config 는 월드보다 오래 살아야 함.
+  /// tick 은 한 틱의 길이(ms), jobs 는 이 월드의 틱을 실행할 스케줄러
+  bool init(const GameConfig& config, int width, int height, uint64_t seed,
+            double tick, JobSystem* jobs);
+
+  /// @brief 고정 틱 하나 진행. 입력은 그 전에 player() 에 적용
+  void tick();
+
+  /// @brief 지금까지 진행한 틱 수
+  uint32_t tickCount() const { return m_tickCount; }
+
+  Registry& registry() { return m_registry; }
+
+  StarManager& starManager() { return m_starManager; }
+
+  /// @brief 점 별 배경. 설정에서 사용하지 않으면 nullptr
+  StarField* starField() { return m_starField; }
+
+  Player& player() { return m_player; }
+
+  EnemyManager& enemyManager() { return m_enemyManager; }
+
+  /// @brief 충돌 목록처럼 한 프레임만 쓰는 메모리. reset 은 월드를 돌리는 쪽이 함
+  FrameArena& frameArena() { return m_frameArena; }
+
+  JobSystem* jobs() { return m_jobs; }
+
+  double tickLength() const { return m_tickLength; }
+
+  const TaskGraph& simulationGraph() const { return m_simulationGraph; }
+
+  /// @brief 월드 자신의 상태(틱 카운터)를 스냅샷에 기록할 때 필요한 최대 바이트.
+  /// 시스템들의 상태는 WorldState 가 각 시스템에서 따로 기록함
+  size_t snapshotCapacity() const;
+
+  void save(SnapshotWriter& writer) const;
+
+  void restore(SnapshotReader& reader);
+
+ private:
+  bool buildSimulationGraph();
+
+ private:
+  JobSystem* m_jobs = nullptr;
+
+  double m_tickLength = 0.0;
+
+  uint32_t m_tickCount = 0;
+
+  Registry m_registry;
+
+  StarManager m_starManager;
+
+  StarField* m_starField = nullptr;
+
+  Player m_player;
+
+  EnemyManager m_enemyManager;
+
+  FrameArena m_frameArena;
+
+  TaskGraph m_simulationGraph;
+};
+
+}  // namespace shmup
@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------
+// File: WorldBatch.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "WorldBatch.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace shmup {
+
+WorldBatch::WorldBatch() {}
+
+WorldBatch::~WorldBatch() {
+  // 월드가 스케줄러를 참조하므로 월드를 먼저 해제
+  delete[] m_worlds;
+  delete[] m_jobs;
+}
+
+bool WorldBatch::init(const GameConfig& config, unsigned worldCount, int width,
+                      int height, uint64_t seed, double tick) {
+  m_jobs = new JobSystem[worldCount];
+  m_worlds = new World[worldCount];
+  if (m_jobs == nullptr || m_worlds == nullptr) {
+    std::cout << "WorldBatch allocate worlds failed \n";
+    return false;
+  }
+  m_worldCount = worldCount;
+
+  for (unsigned i = 0; i < worldCount; ++i) {
+    // 워커 1개: 월드 안의 작업은 그 월드를 맡은 스레드에서 차례로 실행
+    if (m_jobs[i].init(1) == false ||
+        m_worlds[i].init(config, width, height, seed + i, tick,
+                         &m_jobs[i]) == false) {
+      std::cout << "WorldBatch init world " << i << " failed \n";
+      return false;
+    }
+  }
+  return true;
+}
+
+void WorldBatch::runWorld(World* world, unsigned tickCount) {
+  for (unsigned t = 0; t < tickCount; ++t) {
+    // 헤드리스에서는 틱 하나가 한 프레임
+    world->frameArena().reset();
+    world->tick();
+  }
+}
+
+void WorldBatch::run(unsigned tickCount) {
+  std::thread* threads = new std::thread[m_worldCount];
+
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < m_worldCount; ++i) {
+    threads[i] = std::thread(&WorldBatch::runWorld, &m_worlds[i], tickCount);
+  }
+  for (unsigned i = 0; i < m_worldCount; ++i) {
+    threads[i].join();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  delete[] threads;
+
+  m_elapsedSeconds += std::chrono::duration<double>(end - start).count();
+  m_tickCount += (uint64_t)tickCount * m_worldCount;
+}
+
+void WorldBatch::report() const {
+  std::cout << "WorldBatch: " << m_worldCount << " worlds, " << m_tickCount
+            << " ticks in " << m_elapsedSeconds << " s on "
+            << std::thread::hardware_concurrency() << " hardware threads\n";
+  if (m_elapsedSeconds > 0.0 && m_worldCount > 0) {
+    const double ticksPerSecond = m_tickCount / m_elapsedSeconds;
+    std::cout << "  " << ticksPerSecond << " ticks/s total, "
+              << ticksPerSecond / m_worldCount << " ticks/s per world\n";
+  }
+  for (unsigned i = 0; i < m_worldCount; ++i) {
+    World& world = m_worlds[i];
+    std::cout << "  world " << i << ": tick " << world.tickCount()
+              << ", enemies " << world.enemyManager().enemies().count
+              << ", pattern bullets " << world.enemyManager().patterns().count()
+              << "\n";
+  }
+}
+
+}  // namespace shmup
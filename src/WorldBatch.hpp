@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// File: WorldBatch.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "GameConfig.hpp"
+#include "JobSystem.hpp"
+#include "World.hpp"
+
+namespace shmup {
+
+/// @brief 서로 독립인 헤드리스 월드 여러 개를 스레드마다 하나씩 동시에 진행하는 드라이버.
+///
+/// 월드마다 자기 스케줄러(워커 1개)를 두므로 스레드끼리 공유하는 가변 상태가 없다.
+/// 밸런스 테스트나 봇 학습처럼 렌더링 없이 많은 판을 돌릴 때 사용하며,
+/// 전체 코어에서 초당 진행한 틱 수로 처리량을 보고한다.
+class WorldBatch {
+ public:
+  WorldBatch();
+
+  ~WorldBatch();
+
+  WorldBatch(const WorldBatch&) = delete;
+  WorldBatch& operator=(const WorldBatch&) = delete;
+
+  /// @brief worldCount 개의 월드를 초기화. i 번째 월드의 시드는 seed + i
+  bool init(const GameConfig& config, unsigned worldCount, int width,
+            int height, uint64_t seed, double tick);
+
+  /// @brief 모든 월드를 tickCount 틱씩 동시에 진행하고 끝날 때까지 기다림
+  void run(unsigned tickCount);
+
+  /// @brief 걸린 시간과 전체/월드당 초당 틱 수 출력
+  void report() const;
+
+ private:
+  /// @brief 한 스레드가 월드 하나를 진행
+  static void runWorld(World* world, unsigned tickCount);
+
+ private:
+  JobSystem* m_jobs = nullptr;
+
+  World* m_worlds = nullptr;
+
+  unsigned m_worldCount = 0;
+
+  uint64_t m_tickCount = 0;
+
+  double m_elapsedSeconds = 0.0;
+};
+
+}  // namespace shmup
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// File: WorldState.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#include "WorldState.hpp"
+
+#include <iostream>
+
+#include "World.hpp"
+
+namespace shmup {
+
+WorldState::WorldState() {}
+
+WorldState::~WorldState() { delete[] m_buffer; }
+
+bool WorldState::init(World& world) {
+  m_world = &world;
+
+  m_capacity = world.snapshotCapacity() + world.registry().snapshotCapacity() +
+               world.player().snapshotCapacity() +
+               world.enemyManager().snapshotCapacity() +
+               world.starManager().snapshotCapacity();
+  if (world.starField()) {
+    m_capacity += world.starField()->snapshotCapacity();
+  }
+
+  m_buffer = new uint8_t[m_capacity];
+  if (m_buffer == nullptr) {
+    std::cout << "WorldState allocate buffer failed \n";
+    return false;
+  }
+  m_size = 0;
+  return true;
+}
+
+void WorldState::save() {
+  SnapshotWriter writer(m_buffer);
+  m_world->save(writer);
+  m_world->registry().save(writer);
+  m_world->player().save(writer);
+  m_world->enemyManager().save(writer);
+  m_world->starManager().save(writer);
+  if (StarField* starField = m_world->starField()) {
+    starField->save(writer);
+  }
+  m_size = writer.size();
+}
+
+void WorldState::restore() {
+  if (m_size == 0) {
+    return;
+  }
+  SnapshotReader reader(m_buffer);
+  m_world->restore(reader);
+  m_world->registry().restore(reader);
+  m_world->player().restore(reader);
+  m_world->enemyManager().restore(reader);
+  m_world->starManager().restore(reader);
+  if (StarField* starField = m_world->starField()) {
+    starField->restore(reader);
+  }
+}
+
+}  // namespace shmup
@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// File: WorldState.hpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace shmup {
+
+class World;
+
+/// @brief 월드 전체(틱 카운터, 엔티티, 플레이어와 총알 풀, 적/별 매니저의 난수와 타이머,
+/// 탄막, 점 별)를 포인터 없는 하나의 연속된 버퍼로 저장하고 되돌림.
+/// 재생 입력과 프레임 캡처가 틱 번호를 기준으로 하므로 틱 카운터도 함께 되돌린다.
+///
+/// 롤백이나 즉시 되감기에서 틱마다 저장하는 용도라서 살아있는 항목만 memcpy 한다.
+/// 텍스처, 설정, 화면 크기처럼 초기화 이후 바뀌지 않는 것은 기록하지 않으므로
+/// 같은 설정으로 초기화된 월드에서만 restore 할 수 있다.
+class WorldState {
+ public:
+  WorldState();
+
+  ~WorldState();
+
+  WorldState(const WorldState&) = delete;
+  WorldState& operator=(const WorldState&) = delete;
+
+  /// @brief 월드와 각 시스템이 알려주는 최대 크기만큼 버퍼를 미리 할당.
+  /// world 는 초기화가 끝난 상태여야 하며 WorldState 보다 오래 살아야 함
+  bool init(World& world);
+
+  /// @brief 현재 월드를 버퍼에 기록
+  void save();
+
+  /// @brief 마지막으로 save() 한 상태로 월드를 되돌림
+  void restore();
+
+  /// @brief 마지막 save() 로 기록된 바이트. 이 범위를 그대로 복사해도 됨
+  const uint8_t* data() const { return m_buffer; }
+
+  size_t size() const { return m_size; }
+
+  size_t capacity() const { return m_capacity; }
+
+ private:
+  World* m_world = nullptr;
+
+  uint8_t* m_buffer = nullptr;
+
+  size_t m_capacity = 0;
+
+  size_t m_size = 0;
+};
+
+}  // namespace shmup
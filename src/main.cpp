@@ -7,444 +7,875 @@
 
 #include <SDL.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <memory>
 
+#include "AllocationTracker.hpp"
+#include "DrawList.hpp"
+#include "ECS.hpp"
 #include "EnemyManager.hpp"
+#include "FrameArena.hpp"
+#include "FrameCapture.hpp"
+#include "FramePacer.hpp"
+#include "GameConfig.hpp"
+#include "InputQueue.hpp"
+#include "InputRecorder.hpp"
+#include "JobSystem.hpp"
 #include "Math.hpp"
+#include "ObjectPool.hpp"
+#include "OffscreenRenderer.hpp"
 #include "Player.hpp"
 #include "SDLProgram.hpp"
+#include "StarField.hpp"
 #include "StarManager.hpp"
-#include "TGA.hpp"
+#include "TaskGraph.hpp"
+#include "World.hpp"
+#include "WorldBatch.hpp"
+#include "WorldState.hpp"
 #include "Blend.hpp"
 
 #define DRAW_PIXELS_ONCE true
 #define DRAW_EACH_PIXELS false
 #define DRAW_COLLIDER false // for debugging
 
-void drawStars(shmup::SDLRenderer& renderer,
-               const shmup::TGA& tga, const shmup::Star* stars,
-               unsigned starCount) {
-#if DRAW_EACH_PIXELS
-   renderer.enableBlending(SDL_BLENDMODE_BLEND);
-   for (unsigned i = 0; i < starCount; ++i) {
-     const shmup::Star* star = &stars[i];
-     if (star->isVisible()) {
-       renderer.drawTGA(tga, star->position().x, star->position().y);
-     }
-   }
+#if _WIN32
+constexpr auto s_configFilepath = "../resources/game.cfg";
 #else
-  SDL_Texture* tex = const_cast<SDL_Texture*>(tga.sdlTexture());
-  SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
-  SDL_FRect rect;
-  for (unsigned i = 0; i < starCount; ++i) {
-    const shmup::Star& star = stars[i];
-    if (star.isVisible()) {
-      rect.w = star.size().x, rect.h = star.size().y;
-      rect.x = star.position().x, rect.y = star.position().y;
-      SDL_RenderCopyF(renderer.native(), tex, nullptr, &rect);
-    }
-  }
+constexpr auto s_configFilepath = "../../resources/game.cfg";
 #endif
-}
 
-void drawPlayer(shmup::SDLRenderer& renderer,
-                const shmup::Player& player) {
-  renderer.enableBlending(SDL_BLENDMODE_BLEND);
-  renderer.drawTGA(player.planeTexture(), player.position().x,
-                    player.position().y);
-}
+// 창(월드) 크기
+constexpr int s_screenWidth = 480;
+constexpr int s_screenHeight = 640;
+
+// --worlds 만 주고 --ticks 를 생략했을 때 월드마다 진행할 틱 수 (게임 시간 1분)
+constexpr unsigned s_defaultBatchTicks = 3600;
+
+// 시뮬레이션 한 틱의 길이(ms). 모든 상태 변화는 이 간격으로만 진행
+constexpr double s_fixedTimeStep = 1000.0 / 60;
+
+// 한 프레임에서 따라잡을 수 있는 최대 틱 수. 넘치는 시간은 버림
+constexpr unsigned s_maxStepsPerFrame = 5;
+
+// 기본 목표 프레임 레이트. --fps 0 이면 제한 없이 최대한 빠르게 실행
+constexpr double s_defaultTargetFps = 60.0;
 
-void drawBullets(shmup::SDLRenderer& renderer,
-                 const shmup::TGA& tga, const shmup::Bullet* bullets,
-                 unsigned bulletCount) {
+// 입력 큐 크기. 한 프레임 사이에 들어오는 이벤트보다 넉넉하면 됨
+constexpr unsigned s_inputQueueCapacity = 256;
+
+// --fail-on-alloc 사용 시 이 프레임 수 이후의 힙 할당은 실패로 간주
+constexpr unsigned s_allocWarmupFrames = 120;
+
+/// @brief 컬링이 끝난 목록 하나를 그림. 목록의 항목은 모두 화면에 보이는 것
+void drawLayer(shmup::SDLRenderer& renderer, const shmup::DrawList& list) {
+  if (list.count == 0) {
+    return;
+  }
 #if DRAW_EACH_PIXELS
   renderer.enableBlending(SDL_BLENDMODE_BLEND);
-  for (unsigned i = 0; i < bulletCount; ++i) {
-    const shmup::Bullet* bullet = &bullets[i];
-    if (bullet->isVisible()) {
-      renderer.drawTGA(tga, bullet->position().x, bullet->position().y);
-    }
+  for (unsigned i = 0; i < list.count; ++i) {
+    renderer.drawTGA(*list.texture, list.items[i].x, list.items[i].y);
   }
 #else
-  SDL_Texture* texture = const_cast<SDL_Texture*>(tga.sdlTexture());
+  SDL_Texture* texture = renderer.texture(*list.texture);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   SDL_FRect rect;
-  for (unsigned i = 0; i < bulletCount; ++i) {
-    const shmup::Bullet& bullet = bullets[i];
-    if (bullet.isVisible()) {
-      rect.w = bullet.size().x, rect.h = bullet.size().y;
-      rect.x = bullet.position().x, rect.y = bullet.position().y;
-      SDL_RenderCopyF(renderer.native(), texture, nullptr, &rect);
-    }
+  for (unsigned i = 0; i < list.count; ++i) {
+    const shmup::DrawItem& item = list.items[i];
+    rect.x = item.x, rect.y = item.y, rect.w = item.w, rect.h = item.h;
+    SDL_RenderCopyF(renderer.native(), texture, nullptr, &rect);
   }
 #endif
 }
 
-void drawEnemies(shmup::SDLRenderer& renderer,
-                 const shmup::TGA& tga, const shmup::Enemy* enemies,
-                 unsigned enemyCount) {
-#if DRAW_EACH_PIXELS
-  renderer.enableBlending(SDL_BLENDMODE_BLEND);
-  for (unsigned i = 0; i < enemyCount; ++i) {
-    const shmup::Enemy* enemy = &enemies[i];
-    if (enemy->isVisible()) {
-      renderer.drawTGA(tga, enemy->position().x, enemy->position().y);
+void drawStarField(shmup::SDLRenderer& renderer,
+                   const shmup::StarField& starField, float renderOffset,
+                   shmup::FrameArena& frameArena) {
+  // 레이어마다 색이 달라서 레이어 단위로 점을 모아 한번에 그림
+  SDL_FPoint* points =
+      frameArena.allocateArray<SDL_FPoint>(starField.starCount());
+  const float height = (float)starField.height();
+  renderer.disableBlending();
+  for (unsigned l = 0; l < shmup::StarField::s_layerCount; ++l) {
+    const unsigned count = starField.layerCount(l);
+    const float* x = starField.layerX(l);
+    const float* y = starField.layerY(l);
+    const float offset = starField.layerSpeed(l) * renderOffset;
+    for (unsigned i = 0; i < count; ++i) {
+      float py = y[i] + offset;
+      if (py < 0.0f) py += height;
+      points[i] = {x[i], py};
     }
+    const shmup::RGBA color = starField.layerColor(l);
+    SDL_SetRenderDrawColor(renderer.native(), color.r, color.g, color.b, 255);
+    SDL_RenderDrawPointsF(renderer.native(), points, (int)count);
   }
-#else
-  SDL_Texture* texture = const_cast<SDL_Texture*>(tga.sdlTexture());
-  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-  SDL_FRect rect;
-  for (unsigned i = 0; i < enemyCount; ++i) {
-    const shmup::Enemy& enemy = enemies[i];
-    if (enemy.isVisible()) {
-      rect.w = enemy.size().x, rect.h = enemy.size().y;
-      rect.x = enemy.position().x, rect.y = enemy.position().y;
-      SDL_RenderCopyF(renderer.native(), texture, nullptr, &rect);
-    }
+  frameArena.deallocate(points);
+}
+
+#if DRAW_COLLIDER
+// 디버그 충돌체 원 하나를 구성하는 점의 개수
+constexpr unsigned s_debugCircleSegments = 64;
+
+/// @brief 화면에 보이는 충돌체의 중심과 반지름을 모아 둔 목록
+struct ColliderCircles {
+  shmup::Vector2* centers;
+  float* radii;
+  unsigned count;
+};
+
+/// @brief 원 전체가 뷰포트 밖이 아니면 목록에 추가
+void appendColliderCircle(ColliderCircles& circles,
+                          const shmup::CircleCollider& collider,
+                          float viewportWidth, float viewportHeight) {
+  const shmup::Vector2& center = collider.position;
+  if (center.x + collider.radius < 0.0f ||
+      center.x - collider.radius >= viewportWidth ||
+      center.y + collider.radius < 0.0f ||
+      center.y - collider.radius >= viewportHeight) {
+    return;
   }
-#endif
+  circles.centers[circles.count] = center;
+  circles.radii[circles.count] = collider.radius;
+  ++circles.count;
 }
+#endif
 
+/// @brief 충돌체 외곽선을 그릴 때만 점을 만들어서 한번의 드로우 콜로 그림
 void drawColliderLayers(shmup::SDLRenderer& renderer,
-                        const shmup::Enemy* enemies, unsigned enemyCount,
-                        const shmup::Vector2* playerColliderPoints,
-                        const shmup::Bullet* bullets, unsigned bulletCount) {
+                        const shmup::Archetype& enemies,
+                        const shmup::Player& player,
+                        const shmup::ObjectPool<shmup::Bullet>& bullets,
+                        float viewportWidth, float viewportHeight) {
 #if DRAW_COLLIDER
+  // 단위 원 테이블과 모든 오브젝트를 담을 수 있는 버퍼는 처음 필요할 때 한번만 만듦
+  static shmup::CircleTable circleTable;
+  static ColliderCircles circles = {nullptr, nullptr, 0};
+  static shmup::Vector2* outlines = nullptr;
+  static SDL_FPoint* points = nullptr;
+  static unsigned capacity = 0;
+  if (circleTable.segments() == 0 &&
+      circleTable.init(s_debugCircleSegments) == false) {
+    return;
+  }
+  const unsigned required = enemies.count + bullets.liveCount() + 1;
+  if (capacity < required) {
+    delete[] circles.centers;
+    delete[] circles.radii;
+    delete[] outlines;
+    delete[] points;
+    circles.centers = new shmup::Vector2[required];
+    circles.radii = new float[required];
+    outlines = new shmup::Vector2[required * s_debugCircleSegments];
+    points = new SDL_FPoint[required * s_debugCircleSegments];
+    capacity = required;
+  }
+  circles.count = 0;
+
+  // Enemy 충돌체 레이어: 충돌체 위치는 적 위치 기준 오프셋
+  for (unsigned i = 0; i < enemies.count; ++i) {
+    const shmup::CircleCollider collider = {
+        enemies.positions[i] + enemies.colliders[i].position,
+        enemies.colliders[i].radius};
+    appendColliderCircle(circles, collider, viewportWidth, viewportHeight);
+  }
+
+  // Player 충돌체 레이어
+  if (player.hasCollider()) {
+    appendColliderCircle(circles, *player.collider(), viewportWidth,
+                         viewportHeight);
+  }
+
+  // Bullet 충돌체 레이어
+  for (unsigned i = 0; i < bullets.liveCount(); ++i) {
+    const shmup::Bullet& bullet = bullets.live(i);
+    if (bullet.hasCollider()) {
+      appendColliderCircle(circles, *bullet.collider(), viewportWidth,
+                           viewportHeight);
+    }
+  }
+
+  // 모든 원의 외곽선을 한번에 채운 뒤 SDL 점 배열로 옮김.
+  // SDL_FPoint 를 Vector2 로 재해석해서 쓰지 않도록 버퍼를 따로 둠
+  circleTable.outline(circles.centers, circles.radii, circles.count, outlines);
+  const unsigned pointCount = circles.count * s_debugCircleSegments;
+  for (unsigned i = 0; i < pointCount; ++i) {
+    points[i] = {outlines[i].x, outlines[i].y};
+  }
+
   SDL_SetRenderDrawColor(renderer.native(), 255, 255, 255, 255);
+  SDL_RenderDrawPointsF(renderer.native(), points, (int)pointCount);
+#endif
+}
 
-  // Enemy 충돌체 레이어 그리기
-  for (unsigned i = 0; i < enemyCount; ++i) {
-    const shmup::Enemy* enemy = &enemies[i];
-    if (enemy == nullptr) {
-      break;
+// 소프트웨어 합성에서 한 잡이 맡는 최소 줄 수
+constexpr unsigned s_minBandRows = 16;
+
+/// @brief SDL 이벤트에서 게임이 쓰는 값만 뽑아서 기록 가능한 입력 이벤트로 변환
+shmup::InputEvent translateEvent(const SDL_Event& event) {
+  shmup::InputEvent input = {shmup::InputEventOther, 0, 0};
+  switch (event.type) {
+  case SDL_QUIT: {
+    input.type = shmup::InputEventQuit;
+    break;
+  }
+  case SDL_KEYDOWN: {
+    // 키 반복은 누르고 있는 상태가 바뀌지 않으므로 무시
+    if (event.key.repeat == 0) {
+      input.type = shmup::InputEventKeyDown;
+      input.key = event.key.keysym.sym;
     }
+    break;
+  }
+  case SDL_KEYUP: {
+    input.type = shmup::InputEventKeyUp;
+    input.key = event.key.keysym.sym;
+    break;
+  }
+  default: {
+    break;
+  }
+  }
+  return input;
+}
 
-    if (enemy->isVisible() == false) {
-      continue;
+/// @brief SDL 이 이벤트를 큐에 넣는 순간 불리는 감시 콜백.
+/// 게임이 쓰는 이벤트만 들어온 시각과 함께 입력 큐에 넣음
+int inputEventWatch(void* userdata, SDL_Event* event) {
+  const shmup::InputEvent input = translateEvent(*event);
+  if (input.type != shmup::InputEventOther) {
+    static_cast<shmup::InputQueue*>(userdata)->push(
+        input, SDL_GetPerformanceCounter());
+  }
+  return 1;
+}
+
+/// @brief FramePacer 가 기다리는 동안 부름. 들어온 이벤트는 감시 콜백이 입력 큐에 넣음
+void pumpEvents() { SDL_PumpEvents(); }
+
+/// 그리기 목록 그래프가 쓰는 자원. 월드 자원 다음 비트부터 사용
+enum DrawResource : uint32_t {
+  ResourceDrawStars = shmup::ResourceWorldEnd << 0,
+  ResourceDrawPlayer = shmup::ResourceWorldEnd << 1,
+  ResourceDrawBullets = shmup::ResourceWorldEnd << 2,
+  ResourceDrawEnemies = shmup::ResourceWorldEnd << 3,
+  ResourceDrawPatterns = shmup::ResourceWorldEnd << 4,
+};
+
+/// @brief 그리기 목록 작업이 참조하는 것. 작업에는 포인터만 넘김
+struct DrawContext {
+  shmup::World* world;
+  shmup::DrawLists* drawLists;
+
+  // 보간 비율. 프레임마다 갱신
+  float alpha;
+};
+
+void drawStarsTask(void* context) {
+  const DrawContext& ctx = *static_cast<DrawContext*>(context);
+  shmup::StarManager& starManager = ctx.world->starManager();
+  ctx.drawLists->addArchetype(shmup::DrawLayerStars, starManager.tga(),
+                              starManager.stars(), ctx.alpha);
+}
+
+void drawPlayerTask(void* context) {
+  const DrawContext& ctx = *static_cast<DrawContext*>(context);
+  ctx.drawLists->addPlayer(ctx.world->player(), ctx.alpha);
+}
+
+void drawBulletsTask(void* context) {
+  const DrawContext& ctx = *static_cast<DrawContext*>(context);
+  shmup::Player& player = ctx.world->player();
+  ctx.drawLists->addBullets(player.bulletTexture(), player.bullets(),
+                            ctx.alpha);
+}
+
+void drawEnemiesTask(void* context) {
+  const DrawContext& ctx = *static_cast<DrawContext*>(context);
+  shmup::EnemyManager& enemyManager = ctx.world->enemyManager();
+  ctx.drawLists->addArchetype(shmup::DrawLayerEnemies,
+                              enemyManager.enemyTexture(),
+                              enemyManager.enemies(), ctx.alpha);
+}
+
+void drawPatternsTask(void* context) {
+  const DrawContext& ctx = *static_cast<DrawContext*>(context);
+  shmup::EnemyManager& enemyManager = ctx.world->enemyManager();
+  ctx.drawLists->addPatterns(enemyManager.patternBulletTexture(),
+                             enemyManager.patterns(), ctx.alpha);
+}
+
+/// @brief 프레임마다 그리기 목록을 만드는 그래프. 레이어끼리는 겹치지 않으므로
+/// 모든 레이어를 동시에 만듦
+bool buildDrawGraph(shmup::TaskGraph* graph, DrawContext* ctx) {
+  bool added = graph->addTask("draw stars", &drawStarsTask, ctx,
+                              shmup::ResourceStars, ResourceDrawStars);
+  added = added && graph->addTask("draw player", &drawPlayerTask, ctx,
+                                  shmup::ResourcePlayer, ResourceDrawPlayer);
+  added = added && graph->addTask("draw bullets", &drawBulletsTask, ctx,
+                                  shmup::ResourceBullets, ResourceDrawBullets);
+  added = added && graph->addTask("draw enemies", &drawEnemiesTask, ctx,
+                                  shmup::ResourceEnemies, ResourceDrawEnemies);
+  added = added && graph->addTask("draw patterns", &drawPatternsTask, ctx,
+                                  shmup::ResourcePatterns,
+                                  ResourceDrawPatterns);
+  return added;
+}
+
+/// @brief 두 그래프의 구조와 평균 시간, 임계 경로를 JSON 파일로 저장
+bool writeTaskGraphs(const char* path, const shmup::TaskGraph& simulationGraph,
+                     const shmup::TaskGraph& drawGraph) {
+  FILE* file = fopen(path, "w");
+  if (file == nullptr) {
+    std::cout << "Failed to open task graph output: " << path << "\n";
+    return false;
+  }
+  fprintf(file, "{\"graphs\": [\n");
+  simulationGraph.writeJson(file);
+  fprintf(file, ",\n");
+  drawGraph.writeJson(file);
+  fprintf(file, "\n]}\n");
+  fclose(file);
+  return true;
+}
+
+/// @brief 누르고 있는 방향키. 둘 다 누르고 있으면 마지막에 누른 쪽으로 이동
+struct HeldKeys {
+  bool left;
+  bool right;
+  int direction;
+};
+
+/// @brief 입력 이벤트 하나를 처리. 실제 입력과 재생한 입력 모두 여기를 거침
+/// @return 종료 이벤트이면 false
+bool handleInput(const shmup::InputEvent& input, HeldKeys* keys,
+                 shmup::Player* player) {
+  switch (input.type) {
+  case shmup::InputEventQuit: {
+    return false;
+  }
+  case shmup::InputEventKeyDown: {
+    if (input.key == SDLK_RIGHT) {
+      keys->right = true;
+      keys->direction = 1;
+    } else if (input.key == SDLK_LEFT) {
+      keys->left = true;
+      keys->direction = -1;
     }
-    SDL_RenderDrawPointsF(renderer.native(), (const SDL_FPoint*)enemy->debugColliderPoints(), 180);
+    break;
+  }
+  case shmup::InputEventKeyUp: {
+    if (input.key == SDLK_RIGHT) {
+      keys->right = false;
+      keys->direction = keys->left ? -1 : 0;
+    } else if (input.key == SDLK_LEFT) {
+      keys->left = false;
+      keys->direction = keys->right ? 1 : 0;
+    }
+    break;
+  }
+  default: {
+    break;
+  }
   }
 
-  // Player 충돌체 레이어 그리기
-  SDL_RenderDrawPointsF(renderer.native(), (const SDL_FPoint*)playerColliderPoints, 180);
+  player->move(keys->direction);
+  return true;
+}
 
-  // Bullet 충돌체 레이어 그리기
-  for (unsigned i = 0; i < bulletCount; ++i) {
-    const shmup::Bullet* bullet = &bullets[i];
-    if (bullet == nullptr) {
+/// @brief 틱 하나를 실행하기 전에 그 틱에 속하는 입력을 적용.
+/// 실제 입력은 tickEnd(퍼포먼스 카운터) 이전에 들어온 것만 꺼내고 나머지는 다음 틱으로
+/// 미룸. 재생 중에는 기록된 틱 번호가 tick 이하인 이벤트를 적용하고, 실제 입력은
+/// 창 닫기만 받음
+/// @return 종료 이벤트가 있었으면 false
+bool applyTickInput(shmup::InputQueue* queue, shmup::InputRecorder* recorder,
+                    uint32_t tick, uint64_t tickEnd, HeldKeys* keys,
+                    shmup::Player* player) {
+  bool running = true;
+  while (const shmup::TimedInputEvent* timed = queue->peek()) {
+    if (recorder->isReplaying() == false && timed->timestamp > tickEnd) {
       break;
     }
-
-    if (bullet->isVisible() == false) {
+    shmup::InputEvent input = timed->event;
+    queue->pop();
+    if (recorder->isReplaying() && input.type != shmup::InputEventQuit) {
       continue;
     }
-    SDL_RenderDrawPointsF(renderer.native(), (const SDL_FPoint*)bullet->debugPoints(), 180);
+    input.tick = tick;
+    recorder->recordEvent(input);
+    running = handleInput(input, keys, player) && running;
   }
-#endif
+
+  while (const shmup::InputEvent* input = recorder->nextEvent(tick)) {
+    running = handleInput(*input, keys, player) && running;
+  }
+  return running;
 }
 
-/// @brief 충돌 검사하면서 각 적나 총알의 상태가 변경되도록 플래그 설정
-/// 프레임 스킵이 발생했을 때 처리되도록 수행
-/// - 공간분할을 통해 빠르게 할 수 있음; 예시로 쿼드 트리가 있음
-constexpr float s_targetFrameTime = 1000.0f / 30; // 목표 프레임 0.3333..
-void performCollisionChecks(shmup::EnemyManager* enemyManager,
-                  shmup::Player* player,
-                  double delta) {
-  using namespace shmup;
-  /*
-    프레임 스킵이 발생하면 오브젝트는 스킵된 만큼의 위치로 이동하여 충돌 판정으로부터 벗어날 수 있다.
-    프레임 스킵에 대한 적절한 처리로 모든 오브젝트의 충돌 판정을 수행한다.
-    
-    한 프레임 당 16ms 간격이 있다고 가정했을 때, 스킵된 프레임만큼 움직이는 오브젝트들의 예상 위치를 구할 수 있다. 
-    예를 들어, 프레임 당 Y축으로 10만큼 이동하는 오브젝트는 50ms만큼의 프레임이 스킵된 경우 
-    16ms, 32ms 그리고 48ms 시점의 위치를 각 계산할 수 있는 것이다. 
-
-    이때 각 오브젝트의 목적지를 지나지는 않았는지 고려해야 한다. 
-      - 에너미와 불릿 같은 경우에는 목적지를 지나면 곧바로 visible이 꺼지기 때문. 
-    
-    그러므로 목표한 프레임 간격(n)으로 설정되고 시간(d)이 지난 경우 (int)(d / n) + 1개 만큼 
-    이전 프레임에서의 위치를 예상할 수 있을 것이다. 
-     - 예상 프레임 타임 [ n * 1, n * 2 ..., n * (int)(d / n), d ]
-     - 예상 위치 [ s * n * 1, s * n * 2 ..., s * n * (int)(d / n), s * d ]
-  */
-  bool hasFrameSkipped = (delta >= (s_targetFrameTime * 1.5f)); // 이 값은 변경될 수 있음
-  //if(hasFrameSkipped) {
-  //  // Frame has been skipped
-  //  std::cout << "Frame skipped! delta: " << delta << ", target: " << s_targetFrameTime << std::endl;
-  //} else {
-  //  std::cout << "Delta: " << delta << std::endl;
-  //}
-
-  unsigned skippedFrameCount = (unsigned)(delta / s_targetFrameTime);
-
-  for (unsigned i = 0; i < enemyManager->enemyCount(); ++i) {
-    // player <-> enemies
-    Enemy* enemy = &enemyManager->enemies()[i];
-    if(enemy == nullptr) continue;
-
-    if (player->isVisible() && enemy->isVisible()) {
-      // 만약 프레임 스킵이 일어났다면 배열의 형태로 스킵된 프레임마다 오브젝트의 좌표를 구하고 비교
-      bool isCollided = false;
-      if(hasFrameSkipped) {
-        for(unsigned j = 1; j < skippedFrameCount; ++j) {
-          // 두 콜라이더의 정점
-          Vector2 enemyPos = enemy->getColliderCenterByDelta(j * s_targetFrameTime);
-          Vector2 playerPos = player->getColliderCenterByDelta(j * s_targetFrameTime);
-
-          // 적 좌표가 -1.0f, -1.0f 한번이라도 나오면 루프 탈출
-          if(enemyPos == Vector2(-1.0f, -1.0f)) {
-            break;
-          }
+int main(int argc, char** argv) {
+  double targetFps = s_defaultTargetFps;
+  bool vsync = false;
+  const char* recordPath = nullptr;
+  const char* replayPath = nullptr;
+  double replayDelta = 0.0;
+  const char* configPath = nullptr;
+  bool snapshotBench = false;
+  unsigned threadCount = 0;
+  const char* taskGraphPath = nullptr;
+  unsigned batchWorldCount = 0;
+  unsigned batchTickCount = s_defaultBatchTicks;
+  bool headless = false;
+  unsigned frameLimit = 0;
+  const char* frameDirectory = nullptr;
+  unsigned frameInterval = 1;
+  const char* captureDirectory = nullptr;
+  const char* captureTicks = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--fail-on-alloc") == 0) {
+      shmup::AllocationTracker::failOnAllocationAfter(s_allocWarmupFrames);
+    } else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+      targetFps = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--vsync") == 0) {
+      vsync = true;
+    } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+      recordPath = argv[++i];
+    } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      replayPath = argv[++i];
+    } else if (strcmp(argv[i], "--replay-delta") == 0 && i + 1 < argc) {
+      replayDelta = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--config") == 0 && i + 1 < argc) {
+      configPath = argv[++i];
+    } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      threadCount = (unsigned)atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--snapshot-bench") == 0) {
+      snapshotBench = true;
+    } else if (strcmp(argv[i], "--task-graph") == 0 && i + 1 < argc) {
+      taskGraphPath = argv[++i];
+    } else if (strcmp(argv[i], "--worlds") == 0 && i + 1 < argc) {
+      batchWorldCount = (unsigned)atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+      batchTickCount = (unsigned)atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--headless") == 0) {
+      headless = true;
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frameLimit = (unsigned)atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--dump-frames") == 0 && i + 1 < argc) {
+      // 프레임 저장은 창 없이 합성할 때만 하므로 헤드리스로 실행
+      frameDirectory = argv[++i];
+      headless = true;
+    } else if (strcmp(argv[i], "--dump-interval") == 0 && i + 1 < argc) {
+      frameInterval = (unsigned)atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--capture-dir") == 0 && i + 1 < argc) {
+      captureDirectory = argv[++i];
+    } else if (strcmp(argv[i], "--capture-ticks") == 0 && i + 1 < argc) {
+      captureTicks = argv[++i];
+    }
+  }
 
-          float distance = Math::distance(enemyPos, playerPos);
-          if(distance <= (enemy->collider()->radius + player->collider()->radius)) {
-            isCollided = true;
-            break;
-          }
-        }
-      } else {
-        isCollided = GameObject::isCollided(*player, *enemy);
-      }
+#if TEST_PREMULTIPLIED_ALPHA || !DRAW_PIXELS_ONCE
+  // 다른 그리기 경로는 SDL 렌더러로 직접 그리므로 창이 있어야 하고 화면 버퍼도 없음
+  if (headless || captureDirectory != nullptr) {
+    std::cout << "--headless and --capture-dir need the DRAW_PIXELS_ONCE "
+                 "compositor\n";
+    return 1;
+  }
+#endif
 
-      if(isCollided) {
-        //std::cout << "Collision! enemy <-> player \n";
-        player->onCollided(*enemy);
-        enemy->onCollided(*player);
-      }
+  // --capture-dir <dir> --capture-ticks 60,300,900: 지정한 틱의 화면 버퍼를
+  // 저장하고, 모두 저장하면 종료. 골든 프레임과 비교하려면 --replay 와 함께 사용
+  shmup::FrameCapture* frameCapture = nullptr;
+  if (captureDirectory != nullptr) {
+    if (captureTicks == nullptr) {
+      std::cout << "--capture-dir needs --capture-ticks\n";
+      return 1;
     }
-    // Enemies <-> bullet
-    for (unsigned j = 0; j < player->bulletCount(); ++j) {
-      Bullet* bullet = &player->bullets()[j];
-      if(bullet == nullptr) { continue; }
-
-      if (bullet->isVisible() && enemy->isVisible()) {
-        // 만약 프레임 스킵이 일어났다면 배열의 형태로 검사했을 프레임들의
-        // 좌표를 일일이 구한다
-        bool isCollided = false;
-        if (hasFrameSkipped) {
-          for (unsigned k = 1; k < skippedFrameCount; ++k) {
-            // 두 콜라이더의 정점
-            Vector2 enemyPos =
-                enemy->getColliderCenterByDelta((double)k * s_targetFrameTime);
-            Vector2 bulletPos =
-                bullet->getColliderCenterByDelta((double)k * s_targetFrameTime);
-
-            // 적 좌표가 -1.0f, -1.0f 한번이라도 나오면 루프 탈출
-            if (enemyPos == Vector2(-1.0f, -1.0f) || bulletPos == Vector2(-1.0f, -1.0f)) {
-              break;
-            }
-
-            float distance = Math::distance(enemyPos, bulletPos);
-            if (distance <=
-                (enemy->collider()->radius + bullet->collider()->radius)) {
-              // printf(
-              //     "Collision Y [cur: bullet %.1f enemy %.1f] [%.1f "
-              //     "later: bullet %.1f enemy %.1f] \n",
-              //     bullet->collider()->position.y, enemy->collider()->position.y,
-              //     (double)k * s_targetFrameTime, bulletPos.y,
-              //     enemyPos.y);
-              isCollided = true;
-              break;
-            }
-          }
-        } else {
-          isCollided = GameObject::isCollided(*enemy, *bullet);
-        }
+    frameCapture = new shmup::FrameCapture();
+    if (frameCapture->init(captureDirectory, captureTicks) == false) {
+      return 1;
+    }
+    if (replayPath == nullptr) {
+      std::cout << "Capturing without --replay: frames are not reproducible\n";
+    }
+  }
 
-        if (isCollided) {
-          // std::cout << "Collision! enemy <-> bullet \n";
-          enemy->onCollided(*bullet);
-          bullet->onCollided(*enemy);
-        }
-      }
+  // 튜닝 값과 풀 용량. 여기서 한번 읽은 뒤로는 바뀌지 않음
+  // 기본 설정 파일이 없으면 기본값으로 실행하고, 직접 지정한 파일이 없으면 종료
+  shmup::GameConfig loadedConfig;
+  if (shmup::loadGameConfig(configPath ? configPath : s_configFilepath,
+                            &loadedConfig) == false && configPath != nullptr) {
+    std::cout << "Failed to open config: " << configPath << "\n";
+    return 1;
+  }
+  const shmup::GameConfig& config = loadedConfig;
+
+  // --worlds K: 창 없이 서로 독립된 월드 K 개를 스레드마다 하나씩 진행하고
+  // 처리량만 보고한 뒤 종료
+  if (batchWorldCount > 0) {
+    shmup::WorldBatch* batch = new shmup::WorldBatch();
+    if (batch->init(config, batchWorldCount, s_screenWidth, s_screenHeight,
+                    (uint32_t)time(nullptr), s_fixedTimeStep) == false) {
+      return 1;
     }
+    batch->run(batchTickCount);
+    batch->report();
+    delete batch;
+    return 0;
   }
-}
 
-int main(int argc, char** argv) {
-  std::srand((unsigned)time(nullptr));
+  // 입력 기록/재생: 같은 시드와 같은 입력으로 성능을 비교할 수 있게 함
+  // 시드는 각 매니저의 난수 스트림을 초기화하는 데 사용
+  shmup::InputRecorder* recorder = new shmup::InputRecorder();
+  uint32_t seed = (uint32_t)time(nullptr);
+  if (replayPath != nullptr) {
+    if (recorder->openReplay(replayPath) == false) {
+      return 1;
+    }
+    recorder->fixedDelta(replayDelta);
+    seed = recorder->seed();
+  } else if (recordPath != nullptr) {
+    if (recorder->openRecord(recordPath, seed) == false) {
+      return 1;
+    }
+  }
 
   shmup::SDLProgram* program = shmup::SDLProgram::instance();
 
-  if (program->init(400, 0, 480, 640) == false) {
+  if (program->init(400, 0, s_screenWidth, s_screenHeight, vsync,
+                    headless) == false) {
     return 1;
   }
 
-  auto& renderer = program->renderer();
-  auto* nativeRenderer = program->nativeRenderer();
+  // 헤드리스이면 합성한 화면 버퍼를 창 대신 메모리(와 파일)로 보냄
+  // sdlRenderer 는 헤드리스에서 nullptr
+  shmup::SDLRenderer* sdlRenderer = nullptr;
+  shmup::OffscreenRenderer* offscreen = nullptr;
+  if (headless) {
+    offscreen = new shmup::OffscreenRenderer();
+    if (offscreen->init(s_screenWidth, s_screenHeight, frameDirectory,
+                        frameInterval) == false) {
+      return 1;
+    }
+  } else {
+    sdlRenderer = &program->renderer();
+  }
 
-  shmup::StarManager* starManager = new shmup::StarManager();
-  if (starManager->init(nativeRenderer, program->width(), program->height(), 100) ==
-      false) {
+  // 작업 스케줄러. --threads 0(기본값)이면 코어 수만큼 워커를 둠
+  shmup::JobSystem* jobs = new shmup::JobSystem();
+  if (jobs->init(threadCount) == false) {
     return 1;
   }
 
-  shmup::Player* player = new shmup::Player();
-  if (player->loadResource(nativeRenderer) == false) {
+  // 시뮬레이션 상태는 모두 월드가 가짐
+  shmup::World* world = new shmup::World();
+  if (world->init(config, program->width(), program->height(),
+                  seed, s_fixedTimeStep, jobs) == false) {
     return 1;
   }
+  shmup::StarManager* starManager = &world->starManager();
+  shmup::StarField* starField = world->starField();
+  shmup::Player* player = &world->player();
+  shmup::EnemyManager* enemyManager = &world->enemyManager();
+  shmup::FrameArena* frameArena = &world->frameArena();
+
+  // 창에 그릴 때는 월드가 읽은 이미지를 텍스처로 올림
+  if (sdlRenderer) {
+    const shmup::TGA* images[] = {
+        &player->planeTexture(), &player->bulletTexture(),
+        &enemyManager->enemyTexture(), &enemyManager->patternBulletTexture(),
+        &starManager->tga()};
+    for (const shmup::TGA* image : images) {
+      if (sdlRenderer->createTexture(*image) == false) {
+        return 1;
+      }
+    }
+  }
 
-  const SDL_Point startPoint = {
-      (int)(program->width() / 2 -
-            (player->planeTexture().header()->width / 2)),
-      (int)(program->height() - player->planeTexture().header()->height)};
-  player->updatePosition(startPoint.x, startPoint.y);
+  // 레이어별 그리기 목록. 목록 메모리는 프레임 아레나에서 받음
+  shmup::DrawLists* drawLists = new shmup::DrawLists();
 
-  shmup::EnemyManager* enemyManager = new shmup::EnemyManager();
-  if (enemyManager->init(nativeRenderer, program->width(), program->height()) ==
+  // 입력은 SDL 이 이벤트를 큐에 넣는 순간 시각을 붙여서 따로 모아 둠
+  shmup::InputQueue* inputQueue = new shmup::InputQueue();
+  if (inputQueue->init(s_inputQueueCapacity, SDL_GetPerformanceFrequency()) ==
       false) {
-    program->quit();
+    return 1;
+  }
+  SDL_AddEventWatch(&inputEventWatch, inputQueue);
+
+  // 매 프레임 남는 시간은 슬립해서 코어를 놓아줌
+  shmup::FramePacer* pacer = new shmup::FramePacer();
+  pacer->init(targetFps);
+
+  // --snapshot-bench: 매 프레임 월드를 저장하고 바로 되돌려서 비용을 측정
+  shmup::WorldState* worldState = nullptr;
+  if (snapshotBench) {
+    worldState = new shmup::WorldState();
+    if (worldState->init(*world) == false) {
+      return 1;
+    }
   }
+  uint64_t snapshotSaveTicks = 0;
+  uint64_t snapshotRestoreTicks = 0;
+  size_t snapshotBytes = 0;
+  unsigned snapshotCount = 0;
+
+  // 전체 프레임 합성(배경, 별, 레이어)과 내보내기에 걸린 시간
+  uint64_t composeTicks = 0;
+  uint64_t presentTicks = 0;
+  unsigned frameCount = 0;
+
+  // 그리기 목록도 레이어별 작업으로 나눠서 동시에 만듦
+  DrawContext drawContext = {world, drawLists, 0.0f};
+  shmup::TaskGraph drawGraph;
+  drawGraph.init(jobs, "draw lists");
+  if (buildDrawGraph(&drawGraph, &drawContext) == false) {
+    return 1;
+  }
+
+  // 시뮬레이션에 아직 반영하지 않은 시간(ms)
+  double accumulator = 0.0;
+
+  const double countsPerMs = SDL_GetPerformanceFrequency() / 1000.0;
+  HeldKeys heldKeys = {};
 
   // Main loop
   program->updateTime();
   while (program->neededQuit() == false) {
-    
-    // 30fps같이 고정 목표 프레임이 있는 경우 아래와 같은 방식으로도 구현 가능
-    // 여기서 delta 구하기
-    // 시간이 목표한 0.3 보다 작으면 누적하고 업데이트 스킵 
-    // 누적 + 현재 델타가 0.3보다 크면 0.3만큼으로 쪼개서 업데이트 
-    //  예를 들어 1초인 경우 0.3 * 3 으로 3번 업데이트하고 0.1 누적 
-    //update();
-
     {
-      // Update delta
-      program->updateTime();
-      
-      // Handle input events
+      // 이전 프레임의 임시 메모리를 한번에 해제
+      frameArena->reset();
+      shmup::AllocationTracker::beginFrame();
+
+      // 쌓인 SDL 이벤트를 비움. 게임이 쓰는 이벤트는 SDL 큐에 들어오는 순간
+      // 감시 콜백이 시각과 함께 입력 큐로 옮겼으므로 여기서는 버리기만 함
       SDL_Event event;
       while (SDL_PollEvent(&event) != 0) {
-        int move = 0;
-        switch (event.type) {
-        case SDL_QUIT: {
-          program->quit();
-          return 0;
-        }
-        case SDL_KEYDOWN: {
-          switch (event.key.keysym.sym) {
-          case SDLK_RIGHT: {
-            move = 1;
-            break;
-          }
-          case SDLK_LEFT: {
-            move = -1;
-            break;
-          }
-          default: {
-            break;
-          }
-          }
+      }
+
+      // Update delta
+      program->updateTime();
+      double delta = program->delta();
+
+      // 입력 처리와 상태 변화에서 생기는 할당은 "update"로 분류
+      shmup::AllocationZone updateZone("update");
+
+      // 재생 중에는 기록된 delta 와 입력을 사용하고, 기록이 끝나면 종료
+      if (recorder->isReplaying()) {
+        if (recorder->readFrame() == false) {
           break;
         }
-        default: {
+        delta = recorder->frameDelta();
+      }
+
+      // 흘러간 시간을 고정 틱 단위로 잘라서 시뮬레이션
+      // 너무 오래 멈췄다면 따라잡지 않고 남은 시간을 버림
+      accumulator += delta;
+      if (accumulator > s_fixedTimeStep * s_maxStepsPerFrame) {
+        accumulator = s_fixedTimeStep * s_maxStepsPerFrame;
+      }
+
+      // 틱마다 그 틱이 끝나는 시각까지 들어온 입력을 먼저 적용해서
+      // 입력이 들어온 시각에 해당하는 틱부터 반영되게 함
+      const uint64_t frameTime = program->currentTime();
+      bool running = true;
+      while (accumulator >= s_fixedTimeStep) {
+        const uint64_t tickEnd =
+            frameTime -
+            (uint64_t)((accumulator - s_fixedTimeStep) * countsPerMs);
+        running = applyTickInput(inputQueue, recorder, world->tickCount(),
+                                 tickEnd, &heldKeys, player);
+        if (running == false) {
           break;
         }
-        }
 
-        player->move(move);
+        // 각 상태 변화와 충돌 검사
+        world->tick();
+
+        accumulator -= s_fixedTimeStep;
       }
 
-      // 각 상태 변화
-      starManager->updateState(program->delta());
-      player->updateState(program->delta());
-      enemyManager->updateState(program->delta());
+      recorder->writeFrame(delta);
 
-      // 충돌 검사
-      performCollisionChecks(enemyManager, player, program->delta());
+      if (running == false) {
+        break;
+      }
     }
 
+    // 저장 직후에 되돌리므로 게임 상태는 바뀌지 않음
+    if (worldState) {
+      const uint64_t saveStart = SDL_GetPerformanceCounter();
+      worldState->save();
+      const uint64_t restoreStart = SDL_GetPerformanceCounter();
+      worldState->restore();
+      snapshotRestoreTicks += SDL_GetPerformanceCounter() - restoreStart;
+      snapshotSaveTicks += restoreStart - saveStart;
+      snapshotBytes += worldState->size();
+      ++snapshotCount;
+    }
+
+    // 마지막 틱 이후 남은 시간 비율만큼 이전 틱과 현재 틱 사이를 보간해서 그림
+    const float alpha = (float)(accumulator / s_fixedTimeStep);
+    // 점 별은 속도가 일정하므로 이전 위치 대신 현재 위치에서 거꾸로 보간
+    const float starRenderOffset = (float)((alpha - 1.0f) * s_fixedTimeStep);
+
+    shmup::AllocationZone renderZone("render");
+
+    // 보간한 위치로 뷰포트 컬링을 해서 레이어별 그리기 목록을 만듦
+    drawLists->begin(frameArena, (float)program->width(),
+                     (float)program->height());
+    drawContext.alpha = alpha;
+    drawGraph.run();
+
 #if TEST_PREMULTIPLIED_ALPHA
     // 비교 Alpha vs. Premultiplied Alpha 
-    SDL_SetRenderDrawColor(nativeRenderer, 255, 0, 0, 1);
+    SDL_SetRenderDrawColor(sdlRenderer->native(), 255, 0, 0, 1);
     Uint8 r = 0, g = 0, b = 0, a = 0;
-    SDL_GetRenderDrawColor(nativeRenderer, &r, &g, &b, &a);
-    //SDL_SetRenderDrawBlendMode(nativeRenderer, SDL_BLENDMODE_NONE);
-    SDL_SetRenderDrawBlendMode(nativeRenderer, SDL_BLENDMODE_BLEND);
-    renderer.clear();
-    renderer.flush();
-    drawPlayer(renderer, *player);
+    SDL_GetRenderDrawColor(sdlRenderer->native(), &r, &g, &b, &a);
+    //SDL_SetRenderDrawBlendMode(sdlRenderer->native(), SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawBlendMode(sdlRenderer->native(), SDL_BLENDMODE_BLEND);
+    sdlRenderer->clear();
+    sdlRenderer->flush();
+    drawLayer(*sdlRenderer, drawLists->layer(shmup::DrawLayerPlayer));
+    sdlRenderer->present();
 #elif DRAW_PIXELS_ONCE
     // 배경 그리기
     const shmup::RGBA spaceColor = { 12, 10, 40, 255 };
-    renderer.clearColor(spaceColor);
-    
-    SDL_FRect rect;
-    // 스타 그리기
-    for (int i = 0; i < starManager->starCount(); ++i)
-    {
-      const shmup::Star *s = &starManager->stars()[i];
-      if(s->isVisible() == false) {
-        continue;
-      }
-      const shmup::RGBA *tgaPixels = starManager->tga().pixelData();
-      rect.w = s->size().x, rect.h = s->size().y;
-      rect.x = s->position().x, rect.y = s->position().y;
 
-      renderer.renderPixels(tgaPixels, rect);
-    }
-    // 플레이어 그리기
-    const shmup::RGBA* playerPixels = player->planeTexture().pixelData();
-    rect.w = player->size().x, rect.h = player->size().y;
-    rect.x = player->position().x, rect.y = player->position().y;
-    renderer.renderPixels(playerPixels, rect);
-
-    // 총알 그리기
-    for(int i = 0; i < player->bulletCount(); ++i) {
-      const shmup::Bullet* b = &player->bullets()[i];
-      if(b->isVisible() == false) {
-        continue;
+    // 화면을 가로 띠로 나눠서 띠마다 배경, 점 별, 레이어를 차례로 그림.
+    // 띠끼리는 픽셀이 겹치지 않으므로 병렬로 그려도 그리는 순서가 유지됨
+    shmup::Renderer* frameRenderer =
+        offscreen ? (shmup::Renderer*)offscreen : sdlRenderer;
+    const uint64_t composeStart = SDL_GetPerformanceCounter();
+    const int screenHeight = frameRenderer->height();
+    const unsigned bandRows = std::max(
+        s_minBandRows, (unsigned)screenHeight / (jobs->threadCount() * 4));
+    jobs->parallelFor(0, (unsigned)screenHeight, bandRows,
+                      [&](unsigned rowBegin, unsigned rowEnd) {
+      const int top = (int)rowBegin, bottom = (int)rowEnd;
+      frameRenderer->clearColor(spaceColor, top, bottom);
+
+      // 점 별은 버퍼에 바로 찍음
+      if (starField) {
+        starField->plot(frameRenderer->screenBuffer(), frameRenderer->width(),
+                        starRenderOffset, top, bottom);
       }
-      const shmup::RGBA* tgaPixels = player->bulletTexture().pixelData();
-      rect.w = b->size().x, rect.h = b->size().y;
-      rect.x = b->position().x, rect.y = b->position().y;
-
-      renderer.renderPixels(tgaPixels, rect);
-    }
 
-    // 적 그리기
-    for(int i = 0; i < enemyManager->enemyCount(); ++i) {
-      const shmup::Enemy* e = &enemyManager->enemies()[i];
-      if(e->isVisible() == false) {
-        continue;
+      // 레이어 순서대로 보이는 것 중 이 띠에 걸친 것만 그림
+      for (unsigned l = 0; l < shmup::DrawLayerCount; ++l) {
+        const shmup::DrawList& list = drawLists->layer((shmup::DrawLayer)l);
+        if (list.count == 0) {
+          continue;
+        }
+        const shmup::RGBA* pixels = list.texture->pixelData();
+        shmup::FRect rect;
+        for (unsigned i = 0; i < list.count; ++i) {
+          const shmup::DrawItem& item = list.items[i];
+          if (item.y >= bottom || item.y + item.h < top) {
+            continue;
+          }
+          rect.x = item.x, rect.y = item.y, rect.w = item.w, rect.h = item.h;
+          frameRenderer->renderPixels(pixels, rect, top, bottom);
+        }
       }
-      const shmup::RGBA* tgaPixels = enemyManager->enemyTexture().pixelData();
-      rect.w = e->size().x, rect.h = e->size().y;
-      rect.x = e->position().x, rect.y = e->position().y;
+    });
 
-      renderer.renderPixels(tgaPixels, rect);
+    if (frameCapture) {
+      frameCapture->capture(world->tickCount(), *frameRenderer);
     }
-    
-    SDL_RenderClear(nativeRenderer);
-    SDL_UpdateTexture(renderer.m_frameTexture, nullptr, renderer.m_screenBuffer, 
-                      program->width() * sizeof(shmup::RGBA));
-    SDL_RenderCopy(nativeRenderer, renderer.m_frameTexture, NULL, NULL);
+
+    const uint64_t presentStart = SDL_GetPerformanceCounter();
+    frameRenderer->presentScreenBuffer();
+    presentTicks += SDL_GetPerformanceCounter() - presentStart;
+    composeTicks += presentStart - composeStart;
 #else
     // Rendering
-    SDL_SetRenderDrawColor(nativeRenderer, 12, 10, 40, 255);
-    renderer.clear();
-    renderer.disableBlending();
-
-    drawStars(renderer, starManager->tga(), starManager->stars(),
-              starManager->starCount());
-    drawPlayer(renderer, *player);
-    drawBullets(renderer, player->bulletTexture(), player->bullets(),
-                player->bulletCount());
-    drawEnemies(renderer, enemyManager->enemyTexture(), enemyManager->enemies(),
-                enemyManager->enemyCount());
-    drawColliderLayers(renderer, enemyManager->enemies(),
-                       enemyManager->enemyCount(),
-                       player->debugColliderPoints(), player->bullets(),
-                       player->bulletCount());
+    SDL_SetRenderDrawColor(sdlRenderer->native(), 12, 10, 40, 255);
+    sdlRenderer->clear();
+    sdlRenderer->disableBlending();
+
+    if (starField) {
+      drawStarField(*sdlRenderer, *starField, starRenderOffset, *frameArena);
+    }
+    for (unsigned l = 0; l < shmup::DrawLayerCount; ++l) {
+      drawLayer(*sdlRenderer, drawLists->layer((shmup::DrawLayer)l));
+    }
+    drawColliderLayers(*sdlRenderer, enemyManager->enemies(), *player,
+                       player->bullets(), (float)program->width(),
+                       (float)program->height());
+    sdlRenderer->present();
 #endif
-    renderer.present();
+    inputQueue->markPresented(SDL_GetPerformanceCounter());
+    drawLists->end();
+
+    shmup::AllocationTracker::endFrame();
+
+    // --frames N: N 프레임을 그린 뒤 종료
+    if (++frameCount == frameLimit) {
+      break;
+    }
+    if (frameCapture && frameCapture->done()) {
+      break;
+    }
+
+    // 목표 프레임 레이트까지 대기
+    // 기다리는 동안에도 이벤트를 펌프해서 입력 시각을 촘촘하게 기록
+    pacer->wait(&pumpEvents);
 
     //SDL_Delay(1);  // Almost no delayed
 //    SDL_Delay(16);  // 16ms delayed
     //SDL_Delay(16 + rand() / ((RAND_MAX + 1u) / 64));  // 16 ~ 80ms random delayed
   }
 
-  return 0;
+  std::cout << "FrameArena high water mark: "
+            << frameArena->highWaterMark() << " / "
+            << frameArena->capacity() << " bytes, overflow: "
+            << frameArena->overflowCount() << "\n";
+  if (snapshotCount > 0) {
+    const double usPerTick = 1000000.0 / SDL_GetPerformanceFrequency();
+    std::cout << "WorldState: average " << snapshotBytes / snapshotCount
+              << " / " << worldState->capacity() << " bytes, save "
+              << snapshotSaveTicks * usPerTick / snapshotCount
+              << " us, restore "
+              << snapshotRestoreTicks * usPerTick / snapshotCount << " us\n";
+  }
+  if (frameCount > 0 && composeTicks > 0) {
+    const double msPerTick = 1000.0 / SDL_GetPerformanceFrequency();
+    std::cout << (headless ? "Offscreen" : "Screen") << " frames: "
+              << frameCount << ", compose "
+              << composeTicks * msPerTick / frameCount << " ms, present "
+              << presentTicks * msPerTick / frameCount << " ms";
+    if (offscreen && frameDirectory) {
+      std::cout << ", written " << offscreen->writtenCount();
+    }
+    std::cout << "\n";
+  }
+  bool captured = true;
+  if (frameCapture) {
+    captured = frameCapture->done() && frameCapture->failed() == false &&
+               frameCapture->missed() == 0;
+    std::cout << "FrameCapture: " << (captured ? "all " : "incomplete, ")
+              << frameCapture->count() << " ticks requested\n";
+  }
+  shmup::AllocationTracker::report();
+  pacer->report();
+  inputQueue->report();
+  jobs->report();
+  world->simulationGraph().report();
+  drawGraph.report();
+  if (taskGraphPath != nullptr) {
+    writeTaskGraphs(taskGraphPath, world->simulationGraph(), drawGraph);
+  }
+  jobs->shutdown();
+  recorder->close();
+  SDL_DelEventWatch(&inputEventWatch, inputQueue);
+  delete frameCapture;
+  delete offscreen;
+  program->quit();
+  if (captured == false) {
+    return 1;
+  }
+  return shmup::AllocationTracker::failed() ? 2 : 0;
 }
@@ -0,0 +1,134 @@
+//------------------------------------------------------------------------------
+// File: AllocationTest.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+// 헤드리스 월드로 게임 루프 한 프레임(입력, 고정 틱, 그리기 목록, 화면 합성)을
+// 그대로 반복하면서 워밍업 이후 힙 할당이 한번도 없는지 확인한다.
+// 전역 operator new/delete 는 AllocationTracker 가 가로챔 (SHMUP_TRACK_ALLOCATIONS=1).
+// 통과하면 0, 워밍업 이후 할당이 있으면 1, 초기화에 실패하면 2 를 반환.
+
+#include <iostream>
+
+#include "AllocationTracker.hpp"
+#include "DrawList.hpp"
+#include "GameConfig.hpp"
+#include "JobSystem.hpp"
+#include "OffscreenRenderer.hpp"
+#include "World.hpp"
+
+namespace {
+
+#if _WIN32
+constexpr auto s_configFilepath = "../resources/game.cfg";
+#else
+constexpr auto s_configFilepath = "../../resources/game.cfg";
+#endif
+
+constexpr int s_screenWidth = 480;
+constexpr int s_screenHeight = 640;
+constexpr double s_fixedTimeStep = 1000.0 / 60;
+
+// 풀과 아레나가 최고 사용량에 도달할 때까지 기다리는 프레임 수 (게임과 같은 값)
+constexpr unsigned s_warmupFrames = 120;
+
+// 게임 시간 10초. 적이 수백 개로 늘고 탄막과 충돌, 디스폰이 모두 일어남
+constexpr unsigned s_frameCount = 600;
+
+// 한 방향으로 누르고 있는 프레임 수. 좌우로 오가면서 총알과 충돌을 만듦
+constexpr unsigned s_moveFrames = 50;
+
+/// @brief main 의 DRAW_PIXELS_ONCE 경로처럼 그리기 목록을 만들고 화면 버퍼에 합성
+void renderFrame(shmup::World& world, shmup::DrawLists& drawLists,
+                 shmup::Renderer& renderer) {
+  shmup::Player& player = world.player();
+  shmup::EnemyManager& enemyManager = world.enemyManager();
+  shmup::StarManager& starManager = world.starManager();
+
+  drawLists.begin(&world.frameArena(), (float)renderer.width(),
+                  (float)renderer.height());
+  drawLists.addArchetype(shmup::DrawLayerStars, starManager.tga(),
+                         starManager.stars(), 0.5f);
+  drawLists.addPlayer(player, 0.5f);
+  drawLists.addBullets(player.bulletTexture(), player.bullets(), 0.5f);
+  drawLists.addArchetype(shmup::DrawLayerEnemies, enemyManager.enemyTexture(),
+                         enemyManager.enemies(), 0.5f);
+  drawLists.addPatterns(enemyManager.patternBulletTexture(),
+                        enemyManager.patterns(), 0.5f);
+
+  renderer.clearColor({12, 10, 40, 255});
+  if (shmup::StarField* starField = world.starField()) {
+    starField->plot(renderer.screenBuffer(), renderer.width(), 0.0f, 0,
+                    renderer.height());
+  }
+  for (unsigned l = 0; l < shmup::DrawLayerCount; ++l) {
+    const shmup::DrawList& list = drawLists.layer((shmup::DrawLayer)l);
+    for (unsigned i = 0; i < list.count; ++i) {
+      const shmup::DrawItem& item = list.items[i];
+      renderer.renderPixels(list.texture->pixelData(),
+                            {item.x, item.y, item.w, item.h});
+    }
+  }
+  renderer.presentScreenBuffer();
+  drawLists.end();
+}
+
+}  // namespace
+
+int main() {
+  if (shmup::AllocationTracker::enabled() == false) {
+    std::cout << "AllocationTest needs SHMUP_TRACK_ALLOCATIONS=1\n";
+    return 2;
+  }
+
+  shmup::GameConfig config;
+  if (shmup::loadGameConfig(s_configFilepath, &config) == false) {
+    std::cout << "AllocationTest using default config\n";
+  }
+
+  // 워커 사이의 작업 훔치기와 병렬 탄막 갱신도 검사하도록 워커를 둠
+  shmup::JobSystem* jobs = new shmup::JobSystem();
+  shmup::World* world = new shmup::World();
+  shmup::DrawLists* drawLists = new shmup::DrawLists();
+  shmup::OffscreenRenderer* renderer = new shmup::OffscreenRenderer();
+  if (jobs->init(2) == false ||
+      world->init(config, s_screenWidth, s_screenHeight, 1, s_fixedTimeStep,
+                  jobs) == false ||
+      renderer->init(s_screenWidth, s_screenHeight) == false) {
+    std::cout << "AllocationTest init failed\n";
+    return 2;
+  }
+
+  shmup::AllocationTracker::failOnAllocationAfter(s_warmupFrames);
+  for (unsigned frame = 0; frame < s_frameCount; ++frame) {
+    world->frameArena().reset();
+    shmup::AllocationTracker::beginFrame();
+
+    world->player().move(((frame / s_moveFrames) % 2) ? -1 : 1);
+    world->tick();
+    renderFrame(*world, *drawLists, *renderer);
+
+    shmup::AllocationTracker::endFrame();
+  }
+
+  const bool failed = shmup::AllocationTracker::failed();
+  std::cout << "AllocationTest " << s_frameCount << " frames, "
+            << world->enemyManager().enemies().count << " enemies, "
+            << world->enemyManager().patterns().count()
+            << " pattern bullets, arena overflow "
+            << world->frameArena().overflowCount() << ": "
+            << (failed ? "FAILED" : "no heap allocations after warm-up")
+            << "\n";
+  if (failed) {
+    shmup::AllocationTracker::report();
+  }
+
+  jobs->shutdown();
+  delete renderer;
+  delete drawLists;
+  delete world;
+  delete jobs;
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+//------------------------------------------------------------------------------
+// File: GoldenCompare.cpp
+// Author: Chris Redwood
+// Created: 2026-10-19
+// License: MIT License
+//------------------------------------------------------------------------------
+
+// 캡처한 프레임을 골든 프레임과 비교해서 채널별 최대 오차와 PSNR 을 출력한다.
+// 모든 쌍이 기준을 통과하면 0, 하나라도 넘으면 1, 파일을 읽지 못하면 2 를 반환.
+//
+//   shmup_golden_compare [--max-error N] [--min-psnr dB] golden.tga actual.tga ...
+//
+// 기본 기준은 완전히 같은 픽셀(최대 오차 0). 반올림이 조금 다른 빠른 경로는
+// 예를 들어 --max-error 2 --min-psnr 45 처럼 허용 범위를 넓혀서 확인한다.
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "TGA.hpp"
+
+namespace {
+
+// 화면 버퍼와 TGA 의 바이트 순서. RGBA 구조체의 r 자리에 파란색이 들어 있음
+constexpr const char* s_channelNames[4] = {"B", "G", "R", "A"};
+
+/// @brief 두 이미지의 차이
+struct ImageDiff {
+  unsigned maxError[4];
+  double psnr[4];     // 채널별. 같으면 무한대
+  double psnrColor;   // 알파를 뺀 세 채널 전체
+};
+
+double psnrFromSquaredError(double squaredError, double count) {
+  if (squaredError == 0.0) {
+    return INFINITY;
+  }
+  const double mse = squaredError / count;
+  return 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+ImageDiff compareImages(const shmup::RGBA* golden, const shmup::RGBA* actual,
+                        unsigned count) {
+  unsigned maxError[4] = {0, 0, 0, 0};
+  double squaredError[4] = {0.0, 0.0, 0.0, 0.0};
+  for (unsigned i = 0; i < count; ++i) {
+    const uint8_t* a = &golden[i].r;
+    const uint8_t* b = &actual[i].r;
+    for (unsigned c = 0; c < 4; ++c) {
+      const int error = std::abs((int)a[c] - (int)b[c]);
+      maxError[c] = error > (int)maxError[c] ? (unsigned)error : maxError[c];
+      squaredError[c] += (double)(error * error);
+    }
+  }
+
+  ImageDiff diff = {};
+  for (unsigned c = 0; c < 4; ++c) {
+    diff.maxError[c] = maxError[c];
+    diff.psnr[c] = psnrFromSquaredError(squaredError[c], count);
+  }
+  diff.psnrColor = psnrFromSquaredError(
+      squaredError[0] + squaredError[1] + squaredError[2], count * 3.0);
+  return diff;
+}
+
+void printPsnr(double psnr) {
+  if (std::isinf(psnr)) {
+    std::cout << "inf";
+  } else {
+    std::cout << psnr;
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned maxAllowedError = 0;
+  double minPsnr = 0.0;
+  int firstFile = argc;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--max-error") == 0 && i + 1 < argc) {
+      maxAllowedError = (unsigned)std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--min-psnr") == 0 && i + 1 < argc) {
+      minPsnr = std::atof(argv[++i]);
+    } else {
+      firstFile = i;
+      break;
+    }
+  }
+  if (firstFile >= argc || (argc - firstFile) % 2 != 0) {
+    std::cout << "usage: shmup_golden_compare [--max-error N] [--min-psnr dB] "
+                 "golden.tga actual.tga [golden.tga actual.tga ...]\n";
+    return 2;
+  }
+
+  std::cout.setf(std::ios::fixed);
+  std::cout.precision(2);
+
+  unsigned failedCount = 0;
+  for (int i = firstFile; i < argc; i += 2) {
+    const char* goldenPath = argv[i];
+    const char* actualPath = argv[i + 1];
+    shmup::TGA golden, actual;
+    if (golden.readFromFile(goldenPath) == false) {
+      std::cout << "failed to read " << goldenPath << "\n";
+      return 2;
+    }
+    if (actual.readFromFile(actualPath) == false) {
+      std::cout << "failed to read " << actualPath << "\n";
+      return 2;
+    }
+
+    std::cout << actualPath << ": ";
+    const unsigned width = golden.header()->width;
+    const unsigned height = golden.header()->height;
+    if (actual.header()->width != width || actual.header()->height != height) {
+      std::cout << "size " << actual.header()->width << "x"
+                << actual.header()->height << " != golden " << width << "x"
+                << height << " FAIL\n";
+      ++failedCount;
+      continue;
+    }
+
+    const ImageDiff diff =
+        compareImages(golden.pixelData(), actual.pixelData(), width * height);
+    bool passed = diff.psnrColor >= minPsnr;
+    std::cout << "max error";
+    for (unsigned c = 0; c < 4; ++c) {
+      std::cout << " " << s_channelNames[c] << " " << diff.maxError[c];
+      passed = passed && diff.maxError[c] <= maxAllowedError;
+    }
+    std::cout << ", PSNR";
+    for (unsigned c = 0; c < 4; ++c) {
+      std::cout << " " << s_channelNames[c] << " ";
+      printPsnr(diff.psnr[c]);
+    }
+    std::cout << ", color ";
+    printPsnr(diff.psnrColor);
+    std::cout << " dB " << (passed ? "ok" : "FAIL") << "\n";
+    failedCount += passed ? 0 : 1;
+  }
+
+  const unsigned pairCount = (unsigned)(argc - firstFile) / 2;
+  std::cout << pairCount - failedCount << " / " << pairCount
+            << " frames within max error " << maxAllowedError
+            << " and PSNR >= " << minPsnr << " dB\n";
+  return failedCount == 0 ? 0 : 1;
+}